@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "counter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+namespace nfd {
+namespace detail {
+
+constexpr size_t CounterShards::MAX_EXCLUSIVE_SHARDS;
+constexpr size_t CounterShards::SHARED_SHARD;
+constexpr size_t CounterShards::UNASSIGNED;
+
+thread_local size_t CounterShards::s_current = CounterShards::UNASSIGNED;
+
+static std::mutex g_shardsMutex;
+/// whether each exclusive shard is held by a running thread
+static std::array<bool, CounterShards::MAX_EXCLUSIVE_SHARDS> g_isShardInUse;
+
+/** \brief holds an exclusive shard for the lifetime of a thread
+ */
+class CounterShards::ShardHolder : noncopyable
+{
+public:
+  ShardHolder() noexcept
+    : m_shard(SHARED_SHARD)
+  {
+    std::lock_guard<std::mutex> lock(g_shardsMutex);
+    auto it = std::find(g_isShardInUse.begin(), g_isShardInUse.end(), false);
+    if (it != g_isShardInUse.end()) {
+      *it = true;
+      m_shard = static_cast<size_t>(std::distance(g_isShardInUse.begin(), it));
+    }
+  }
+
+  ~ShardHolder()
+  {
+    // counters updated later during thread exit must not use the released shard
+    s_current = SHARED_SHARD;
+
+    if (m_shard != SHARED_SHARD) {
+      std::lock_guard<std::mutex> lock(g_shardsMutex);
+      g_isShardInUse[m_shard] = false;
+    }
+  }
+
+  size_t
+  getShard() const noexcept
+  {
+    return m_shard;
+  }
+
+private:
+  size_t m_shard;
+};
+
+size_t
+CounterShards::assignCurrent() noexcept
+{
+  static thread_local ShardHolder holder;
+  s_current = holder.getShard();
+  return s_current;
+}
+
+} // namespace detail
+
+using detail::CounterShards;
+
+SimpleCounter::~SimpleCounter()
+{
+  delete[] m_slots.load(std::memory_order_relaxed);
+}
+
+void
+SimpleCounter::set(rep value) noexcept
+{
+  m_value.store(value, std::memory_order_relaxed);
+  Slot* slots = m_slots.load(std::memory_order_acquire);
+  if (slots != nullptr) {
+    for (size_t i = 0; i < CounterShards::SHARED_SHARD; ++i) {
+      slots[i].value.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+SimpleCounter::rep
+SimpleCounter::sumSlots(const Slot* slots) noexcept
+{
+  rep sum = 0;
+  for (size_t i = 0; i < CounterShards::SHARED_SHARD; ++i) {
+    sum += slots[i].value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+void
+SimpleCounter::addToSlot(size_t shard, rep n) noexcept
+{
+  BOOST_ASSERT(shard > 0 && shard <= CounterShards::SHARED_SHARD);
+
+  Slot* slots = m_slots.load(std::memory_order_acquire);
+  if (slots == nullptr) {
+    // another thread may be allocating the slots at the same time
+    auto newSlots = new Slot[CounterShards::SHARED_SHARD];
+    if (m_slots.compare_exchange_strong(slots, newSlots, std::memory_order_acq_rel)) {
+      slots = newSlots;
+    }
+    else {
+      delete[] newSlots;
+    }
+  }
+
+  // the values of two slots are 64 octets apart, so they are never in the same cache line
+  std::atomic<rep>& value = slots[shard - 1].value;
+  if (shard == CounterShards::SHARED_SHARD) {
+    value.fetch_add(n, std::memory_order_relaxed);
+  }
+  else {
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+}
+
+} // namespace nfd
@@ -28,35 +28,116 @@
 
 #include "core/common.hpp"
 
+#include <atomic>
+
 namespace nfd {
 
+namespace detail {
+
+/** \brief identifies the calling thread among the threads that update counters
+ *
+ *  The first thread that updates any counter gets shard 0, which is stored inline in each
+ *  counter. Other threads get shards 1 to CounterShards::MAX_EXCLUSIVE_SHARDS-1 while they are
+ *  running, and release them when they exit. Threads beyond that share the last shard.
+ */
+class CounterShards
+{
+public:
+  static constexpr size_t MAX_EXCLUSIVE_SHARDS = 64;
+  static constexpr size_t SHARED_SHARD = MAX_EXCLUSIVE_SHARDS;
+
+  /** \return shard of the calling thread
+   */
+  static size_t
+  getCurrent() noexcept
+  {
+    size_t shard = s_current;
+    return shard != UNASSIGNED ? shard : assignCurrent();
+  }
+
+private:
+  /** \brief assign a shard to the calling thread, which is released when the thread exits
+   */
+  static size_t
+  assignCurrent() noexcept;
+
+private:
+  class ShardHolder;
+
+  static constexpr size_t UNASSIGNED = std::numeric_limits<size_t>::max();
+  static thread_local size_t s_current;
+};
+
+} // namespace detail
+
 /** \brief represents a counter that encloses an integer value
  *
  *  SimpleCounter is noncopyable, because increment should be called on the counter,
  *  not a copy of it; it's implicitly convertible to an integral type to be observed
+ *
+ *  The counter can be updated and observed from multiple threads without locking. Each thread
+ *  writes its own slot with relaxed atomic operations, which compile to plain loads and stores
+ *  on common platforms, and an observation adds up all slots. The slot of the first thread
+ *  that updates any counter (normally the main thread) is stored inline. Slots of other
+ *  threads are padded to a cache line each, and are allocated when a counter is first updated
+ *  from another thread.
  */
 class SimpleCounter : noncopyable
 {
 public:
   typedef uint64_t rep;
 
+  SimpleCounter() noexcept = default;
+
+  ~SimpleCounter();
+
   /** \brief observe the counter
    */
   operator rep() const noexcept
   {
-    return m_value;
+    rep value = m_value.load(std::memory_order_relaxed);
+    const Slot* slots = m_slots.load(std::memory_order_acquire);
+    return slots == nullptr ? value : value + sumSlots(slots);
   }
 
   /** \brief replace the counter value
+   *  \warning Updates from other threads that happen concurrently may be lost.
+   */
+  void
+  set(rep value) noexcept;
+
+protected:
+  /** \brief add \p n to the slot of the calling thread
    */
   void
-  set(rep value) noexcept
+  add(rep n) noexcept
   {
-    m_value = value;
+    if (detail::CounterShards::getCurrent() == 0) {
+      // only one thread writes to this slot
+      m_value.store(m_value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    else {
+      addToSlot(detail::CounterShards::getCurrent(), n);
+    }
   }
 
-protected:
-  rep m_value = 0;
+private:
+  struct Slot
+  {
+    std::atomic<rep> value{0};
+    char padding[64 - sizeof(std::atomic<rep>)];
+  };
+
+  static rep
+  sumSlots(const Slot* slots) noexcept;
+
+  void
+  addToSlot(size_t shard, rep n) noexcept;
+
+private:
+  std::atomic<rep> m_value{0};
+  /// slots of shards 1 to SHARED_SHARD, at index shard-1; nullptr until needed
+  std::atomic<Slot*> m_slots{nullptr};
 };
 
 /** \brief represents a counter of number of packets
@@ -71,7 +152,7 @@ public:
   PacketCounter&
   operator++() noexcept
   {
-    ++m_value;
+    add(1);
     return *this;
   }
   // postfix ++ operator is not provided because it's not needed
@@ -89,7 +170,26 @@ public:
   ByteCounter&
   operator+=(rep n) noexcept
   {
-    m_value += n;
+    add(n);
+    return *this;
+  }
+};
+
+/** \brief represents a counter of accumulated time, in nanoseconds
+ *
+ *  \warning The counter value may wrap after exceeding the range of underlying integer type.
+ */
+class DurationCounter : public SimpleCounter
+{
+public:
+  /** \brief increase the counter
+   *  \pre \p duration is not negative
+   */
+  DurationCounter&
+  operator+=(time::nanoseconds duration) noexcept
+  {
+    BOOST_ASSERT(duration >= time::nanoseconds::zero());
+    add(static_cast<rep>(duration.count()));
     return *this;
   }
 };
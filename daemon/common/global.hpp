@@ -29,6 +29,8 @@
 
 namespace nfd {
 
+class TimerWheel;
+
 /** \brief Returns the global io_service instance for the calling thread.
  */
 boost::asio::io_service&
@@ -39,6 +41,13 @@ getGlobalIoService();
 Scheduler&
 getScheduler();
 
+/** \brief Returns the global TimerWheel instance for the calling thread.
+ *
+ *  The TimerWheel is driven by the Scheduler of the calling thread.
+ */
+TimerWheel&
+getTimerWheel();
+
 boost::asio::io_service&
 getMainIoService();
 
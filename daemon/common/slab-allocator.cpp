@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/slab-allocator.hpp"
+
+namespace nfd {
+
+SlabPool::SlabPool(size_t nBlocksPerSlab)
+  : m_nBlocksPerSlab(nBlocksPerSlab)
+{
+  BOOST_ASSERT(m_nBlocksPerSlab > 0);
+}
+
+SlabPool::~SlabPool()
+{
+  for (void* slab : m_slabs) {
+    ::operator delete(slab);
+  }
+}
+
+void*
+SlabPool::allocate(size_t size)
+{
+  if (m_blockSize == 0) {
+    // each block must be able to hold the free list link, and keep the next block aligned
+    constexpr size_t alignment = alignof(std::max_align_t);
+    m_blockSize = (std::max(size, sizeof(void*)) + alignment - 1) / alignment * alignment;
+  }
+  BOOST_ASSERT(size <= m_blockSize);
+
+  if (m_freeList == nullptr) {
+    addSlab();
+  }
+
+  void* block = m_freeList;
+  m_freeList = *static_cast<void**>(block);
+  ++m_nAllocatedBlocks;
+  return block;
+}
+
+void
+SlabPool::deallocate(void* block) noexcept
+{
+  *static_cast<void**>(block) = m_freeList;
+  m_freeList = block;
+  --m_nAllocatedBlocks;
+}
+
+void
+SlabPool::addSlab()
+{
+  m_slabs.reserve(m_slabs.size() + 1);
+  auto slab = static_cast<uint8_t*>(::operator new(m_nBlocksPerSlab * m_blockSize));
+  m_slabs.push_back(slab);
+
+  for (size_t i = m_nBlocksPerSlab; i > 0; --i) {
+    void* block = slab + (i - 1) * m_blockSize;
+    *static_cast<void**>(block) = m_freeList;
+    m_freeList = block;
+  }
+}
+
+} // namespace nfd
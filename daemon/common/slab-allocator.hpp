@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_SLAB_ALLOCATOR_HPP
+#define NFD_DAEMON_COMMON_SLAB_ALLOCATOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+/** \brief A pool of equally sized memory blocks carved out of larger slabs
+ *
+ *  The block size is determined by the first allocation. Freed blocks are kept in a free list
+ *  for reuse, and slabs are returned to the system only when the pool is destroyed.
+ *  SlabPool is not thread-safe.
+ */
+class SlabPool : noncopyable
+{
+public:
+  explicit
+  SlabPool(size_t nBlocksPerSlab = 256);
+
+  ~SlabPool();
+
+  /** \brief allocate a block of at least \p size octets
+   *  \pre \p size does not exceed the size of the first allocation
+   */
+  void*
+  allocate(size_t size);
+
+  /** \brief return a block to the pool
+   *  \pre \p block was obtained from allocate() on this pool
+   */
+  void
+  deallocate(void* block) noexcept;
+
+  /** \return size of each block, or zero if nothing has been allocated yet
+   */
+  size_t
+  getBlockSize() const
+  {
+    return m_blockSize;
+  }
+
+  /** \return number of blocks currently allocated
+   */
+  size_t
+  getNAllocatedBlocks() const
+  {
+    return m_nAllocatedBlocks;
+  }
+
+  /** \return number of octets obtained from the system for slabs
+   */
+  size_t
+  getNReservedBytes() const
+  {
+    return m_slabs.size() * m_nBlocksPerSlab * m_blockSize;
+  }
+
+private:
+  void
+  addSlab();
+
+private:
+  const size_t m_nBlocksPerSlab;
+  size_t m_blockSize = 0;
+  size_t m_nAllocatedBlocks = 0;
+  std::vector<void*> m_slabs;
+  void* m_freeList = nullptr;
+};
+
+/** \brief An allocator that places single objects into a shared SlabPool
+ *
+ *  This is meant to be used with std::allocate_shared, so that an object and its control block
+ *  share one block of the pool. Allocations of a different size fall back to operator new.
+ *  Every copy of the allocator keeps the pool alive, so that objects may outlive their owner.
+ */
+template<typename T>
+class SlabAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  SlabAllocator(shared_ptr<SlabPool> pool)
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  SlabAllocator(const SlabAllocator<U>& other) noexcept
+    : m_pool(other.m_pool)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (!usePool(n)) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(m_pool->allocate(sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (!usePool(n)) {
+      ::operator delete(p);
+      return;
+    }
+    m_pool->deallocate(p);
+  }
+
+  friend bool
+  operator==(const SlabAllocator& lhs, const SlabAllocator& rhs) noexcept
+  {
+    return lhs.m_pool == rhs.m_pool;
+  }
+
+  friend bool
+  operator!=(const SlabAllocator& lhs, const SlabAllocator& rhs) noexcept
+  {
+    return lhs.m_pool != rhs.m_pool;
+  }
+
+private:
+  bool
+  usePool(size_t n) const noexcept
+  {
+    return n == 1 && alignof(T) <= alignof(std::max_align_t) &&
+           (m_pool->getBlockSize() == 0 || sizeof(T) <= m_pool->getBlockSize());
+  }
+
+private:
+  shared_ptr<SlabPool> m_pool;
+
+  template<typename U>
+  friend class SlabAllocator;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_SLAB_ALLOCATOR_HPP
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_SPSC_RING_HPP
+#define NFD_DAEMON_COMMON_SPSC_RING_HPP
+
+#include "core/common.hpp"
+
+#include <atomic>
+
+namespace nfd {
+
+/** \brief A bounded lock-free queue with one producer thread and one consumer thread
+ *
+ *  The capacity is rounded up to a power of two. tryPush() may only be called by the producer
+ *  and tryPop() may only be called by the consumer; size() may be called by either thread,
+ *  and is exact only when the other thread is not operating on the ring.
+ *
+ *  \tparam T element type; must be default-constructible and move-assignable
+ */
+template<typename T>
+class SpscRing : noncopyable
+{
+public:
+  explicit
+  SpscRing(size_t capacity)
+    : m_mask(roundUpToPowerOfTwo(std::max<size_t>(capacity, 1)) - 1)
+    , m_slots(make_unique<T[]>(m_mask + 1))
+  {
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_mask + 1;
+  }
+
+  size_t
+  size() const
+  {
+    size_t head = m_consumer.position.load(std::memory_order_acquire);
+    size_t tail = m_producer.position.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool
+  empty() const
+  {
+    return size() == 0;
+  }
+
+  /** \brief append \p item at the tail, called on the producer thread
+   *  \retval false the ring is full, \p item is left unchanged
+   */
+  bool
+  tryPush(T&& item)
+  {
+    size_t tail = m_producer.position.load(std::memory_order_relaxed);
+    if (tail - m_producer.cachedOther > m_mask) {
+      // the cached head is stale, reload it only when the ring appears full
+      m_producer.cachedOther = m_consumer.position.load(std::memory_order_acquire);
+      if (tail - m_producer.cachedOther > m_mask) {
+        return false;
+      }
+    }
+
+    m_slots[tail & m_mask] = std::move(item);
+    m_producer.position.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** \brief remove the item at the head into \p item, called on the consumer thread
+   *  \retval false the ring is empty
+   *
+   *  The slot is reset to a default-constructed T, so that the ring does not hold on to
+   *  resources of items that have been consumed.
+   */
+  bool
+  tryPop(T& item)
+  {
+    size_t head = m_consumer.position.load(std::memory_order_relaxed);
+    if (head == m_consumer.cachedOther) {
+      // the cached tail is stale, reload it only when the ring appears empty
+      m_consumer.cachedOther = m_producer.position.load(std::memory_order_acquire);
+      if (head == m_consumer.cachedOther) {
+        return false;
+      }
+    }
+
+    item = std::move(m_slots[head & m_mask]);
+    m_slots[head & m_mask] = T();
+    m_consumer.position.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static size_t
+  roundUpToPowerOfTwo(size_t n)
+  {
+    size_t p = 1;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  /** \brief the index written by one thread, and that thread's copy of the other index
+   *
+   *  Indices increase monotonically and wrap around at SIZE_MAX. Padding keeps the consumer's
+   *  and the producer's cursors on separate cache lines.
+   */
+  struct Cursor
+  {
+    char paddingBefore[64];
+    std::atomic<size_t> position{0};
+    size_t cachedOther = 0;
+    char paddingAfter[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+  };
+
+private:
+  const size_t m_mask;
+  unique_ptr<T[]> m_slots;
+  Cursor m_consumer; ///< position is the head
+  Cursor m_producer; ///< position is the tail
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_SPSC_RING_HPP
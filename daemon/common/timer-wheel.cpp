@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/timer-wheel.hpp"
+
+namespace nfd {
+
+const time::nanoseconds TimerWheel::GRANULARITY = 1_ms;
+
+void
+WheelTimer::cancel()
+{
+  if (m_wheel == nullptr) {
+    return;
+  }
+
+  m_wheel->unlink(*this);
+  // the callback may own the object that contains this timer, so it is destroyed last
+  auto callback = std::move(m_callback);
+  m_callback = nullptr;
+}
+
+TimerWheel::TimerWheel(Scheduler& scheduler)
+  : m_scheduler(scheduler)
+  , m_currentTick(toTick(time::steady_clock::now()))
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+  // callbacks are destroyed only after every timer is detached, because destroying a callback
+  // may destroy the objects that contain other timers
+  std::vector<std::function<void()>> callbacks;
+  callbacks.reserve(m_size);
+  for (Slot& slot : m_slots) {
+    for (WheelTimer* timer = slot.head; timer != nullptr; ) {
+      WheelTimer* next = timer->m_next;
+      callbacks.push_back(std::move(timer->m_callback));
+      timer->m_callback = nullptr;
+      timer->m_wheel = nullptr;
+      timer->m_prev = timer->m_next = nullptr;
+      timer = next;
+    }
+    slot.head = slot.tail = nullptr;
+  }
+  m_size = 0;
+}
+
+uint64_t
+TimerWheel::toTick(time::steady_clock::TimePoint t)
+{
+  return static_cast<uint64_t>(t.time_since_epoch().count()) /
+         static_cast<uint64_t>(GRANULARITY.count());
+}
+
+void
+TimerWheel::schedule(WheelTimer& timer, time::nanoseconds delay, std::function<void()> callback)
+{
+  timer.cancel();
+
+  auto now = time::steady_clock::now();
+  if (m_size == 0 && !m_isAdvancing) {
+    // nothing is on the wheel, so it can skip the idle ticks
+    m_currentTick = std::max(m_currentTick, toTick(now));
+  }
+
+  // round up, so that the timer never fires early
+  auto expiry = static_cast<uint64_t>((now + std::max(delay, 0_ns)).time_since_epoch().count());
+  auto granularity = static_cast<uint64_t>(GRANULARITY.count());
+  timer.m_wheel = this;
+  timer.m_expiry = (expiry + granularity - 1) / granularity;
+  timer.m_callback = std::move(callback);
+  ++m_size;
+
+  if (delay <= 0_ns || timer.m_expiry < m_currentTick) {
+    append(DUE_SLOT, timer);
+  }
+  else {
+    link(timer);
+  }
+  updateDriver();
+}
+
+void
+TimerWheel::link(WheelTimer& timer)
+{
+  BOOST_ASSERT(timer.m_expiry >= m_currentTick);
+
+  // timers beyond the range of the top level are parked in its farthest slot
+  constexpr uint64_t maxDelta = (uint64_t(1) << (SLOT_BITS * N_LEVELS)) - 1;
+  uint64_t tick = std::min(timer.m_expiry, m_currentTick + maxDelta);
+  uint64_t delta = tick - m_currentTick;
+
+  size_t level = 0;
+  while (delta >> (SLOT_BITS * (level + 1)) != 0) {
+    ++level;
+  }
+  size_t index = (tick >> (SLOT_BITS * level)) & (N_SLOTS - 1);
+  append(level * N_SLOTS + index, timer);
+  m_occupied[level] |= uint64_t(1) << index;
+}
+
+void
+TimerWheel::append(size_t slot, WheelTimer& timer)
+{
+  Slot& s = m_slots[slot];
+  timer.m_slot = slot;
+  timer.m_prev = s.tail;
+  timer.m_next = nullptr;
+  if (s.tail == nullptr) {
+    s.head = &timer;
+  }
+  else {
+    s.tail->m_next = &timer;
+  }
+  s.tail = &timer;
+}
+
+void
+TimerWheel::unlink(WheelTimer& timer)
+{
+  BOOST_ASSERT(timer.m_wheel == this);
+
+  Slot& s = m_slots[timer.m_slot];
+  if (timer.m_prev == nullptr) {
+    s.head = timer.m_next;
+  }
+  else {
+    timer.m_prev->m_next = timer.m_next;
+  }
+  if (timer.m_next == nullptr) {
+    s.tail = timer.m_prev;
+  }
+  else {
+    timer.m_next->m_prev = timer.m_prev;
+  }
+
+  if (s.head == nullptr && timer.m_slot != DUE_SLOT) {
+    m_occupied[timer.m_slot / N_SLOTS] &= ~(uint64_t(1) << (timer.m_slot % N_SLOTS));
+  }
+
+  timer.m_wheel = nullptr;
+  timer.m_prev = timer.m_next = nullptr;
+  --m_size;
+}
+
+void
+TimerWheel::cascade(size_t level, size_t index)
+{
+  Slot& s = m_slots[level * N_SLOTS + index];
+  WheelTimer* timer = s.head;
+  s.head = s.tail = nullptr;
+  m_occupied[level] &= ~(uint64_t(1) << index);
+
+  while (timer != nullptr) {
+    WheelTimer* next = timer->m_next;
+    link(*timer);
+    timer = next;
+  }
+}
+
+void
+TimerWheel::fire(size_t slot)
+{
+  Slot& s = m_slots[slot];
+  while (s.head != nullptr) {
+    WheelTimer& timer = *s.head;
+    unlink(timer);
+    auto callback = std::move(timer.m_callback);
+    timer.m_callback = nullptr;
+    // the timer may be destroyed or re-armed by the callback, so it is not accessed afterwards
+    callback();
+  }
+}
+
+void
+TimerWheel::advance()
+{
+  m_isAdvancing = true;
+  uint64_t nowTick = toTick(time::steady_clock::now());
+
+  fire(DUE_SLOT);
+  while (m_currentTick <= nowTick && m_size > 0) {
+    for (size_t level = N_LEVELS - 1; level > 0; --level) {
+      if ((m_currentTick & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) == 0) {
+        cascade(level, (m_currentTick >> (SLOT_BITS * level)) & (N_SLOTS - 1));
+      }
+    }
+    fire(m_currentTick & (N_SLOTS - 1));
+    // timers that became due while firing this tick must not wait for the next one
+    fire(DUE_SLOT);
+    ++m_currentTick;
+  }
+  m_currentTick = std::max(m_currentTick, nowTick + 1);
+
+  m_isAdvancing = false;
+  updateDriver();
+}
+
+uint64_t
+TimerWheel::computeNextTick() const
+{
+  uint64_t next = NO_TICK;
+
+  uint64_t occupied = m_occupied[0];
+  if (occupied != 0) {
+    // rotate the bitmap so that bit 0 corresponds to m_currentTick
+    unsigned shift = m_currentTick & (N_SLOTS - 1);
+    if (shift != 0) {
+      occupied = (occupied >> shift) | (occupied << (N_SLOTS - shift));
+    }
+    unsigned offset = 0;
+    while ((occupied & 1) == 0) {
+      occupied >>= 1;
+      ++offset;
+    }
+    next = m_currentTick + offset;
+  }
+
+  for (size_t level = 1; level < N_LEVELS; ++level) {
+    if (m_occupied[level] != 0) {
+      // level-1 slots are cascaded at every multiple of N_SLOTS, which is sufficient to wake
+      // up for higher levels as well, because their boundaries are also such multiples
+      next = std::min(next, (m_currentTick + N_SLOTS - 1) & ~uint64_t(N_SLOTS - 1));
+      break;
+    }
+  }
+
+  return next;
+}
+
+void
+TimerWheel::updateDriver()
+{
+  if (m_isAdvancing) {
+    return;
+  }
+
+  uint64_t next = m_slots[DUE_SLOT].head != nullptr ? 0 : computeNextTick();
+  if (next == NO_TICK || next >= m_driverTick) {
+    // either nothing to do, or the driver already fires early enough
+    return;
+  }
+
+  auto delay = time::nanoseconds(static_cast<int64_t>(next) * GRANULARITY.count()) -
+               time::steady_clock::now().time_since_epoch();
+  m_driverTick = next;
+  m_driver = m_scheduler.schedule(std::max(delay, 0_ns), [this] {
+    m_driverTick = NO_TICK;
+    advance();
+  });
+}
+
+} // namespace nfd
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+#define NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+class TimerWheel;
+
+/** \brief A timer that can be armed on a TimerWheel
+ *
+ *  A WheelTimer is embedded in the object it belongs to, so that arming and cancelling it
+ *  does not allocate. It is cancelled when destroyed.
+ */
+class WheelTimer : noncopyable
+{
+public:
+  WheelTimer() = default;
+
+  ~WheelTimer()
+  {
+    cancel();
+  }
+
+  /** \return whether the timer is armed and has not expired
+   */
+  bool
+  isArmed() const
+  {
+    return m_wheel != nullptr;
+  }
+
+  /** \brief cancel the timer if it is armed
+   *
+   *  The callback is released. If the callback holds the last reference to the object that
+   *  contains this timer, that object is destroyed.
+   */
+  void
+  cancel();
+
+private:
+  TimerWheel* m_wheel = nullptr;
+  WheelTimer* m_prev = nullptr;
+  WheelTimer* m_next = nullptr;
+  size_t m_slot = 0; ///< index of the slot in TimerWheel::m_slots
+  uint64_t m_expiry = 0; ///< expiry tick
+  std::function<void()> m_callback;
+
+  friend class TimerWheel;
+};
+
+/** \brief A hierarchical timing wheel with millisecond granularity
+ *
+ *  Arming and cancelling a WheelTimer takes constant time. The wheel has N_LEVELS levels of
+ *  N_SLOTS slots each, every level covering N_SLOTS times the range of the one below it.
+ *  A timer is placed on the lowest level whose range covers its expiry, and moves down one
+ *  or more levels when the wheel reaches its slot on the higher level.
+ *
+ *  The wheel is driven by a single event on the Scheduler, which is scheduled at the next tick
+ *  that has timers to fire or to move down. Timers fire at most one GRANULARITY late,
+ *  and never early. A timer armed with a non-positive delay, or one whose tick has already
+ *  been processed, fires on the next driver event.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  explicit
+  TimerWheel(Scheduler& scheduler);
+
+  ~TimerWheel();
+
+  /** \brief arm \p timer to invoke \p callback after \p delay
+   *
+   *  If \p timer is already armed, it is cancelled first.
+   */
+  void
+  schedule(WheelTimer& timer, time::nanoseconds delay, std::function<void()> callback);
+
+  /** \return number of armed timers
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+public:
+  static const time::nanoseconds GRANULARITY;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static constexpr size_t N_LEVELS = 4;
+  static constexpr unsigned SLOT_BITS = 6;
+  static constexpr size_t N_SLOTS = size_t(1) << SLOT_BITS;
+  static constexpr size_t DUE_SLOT = N_LEVELS * N_SLOTS;
+  static constexpr uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+  /** \return the last tick that begins at or before \p t
+   */
+  static uint64_t
+  toTick(time::steady_clock::TimePoint t);
+
+  /** \brief compute the next tick that has timers to fire or to move down
+   *  \return the tick, or NO_TICK if no timer is on the wheel
+   */
+  uint64_t
+  computeNextTick() const;
+
+private:
+  struct Slot
+  {
+    WheelTimer* head = nullptr;
+    WheelTimer* tail = nullptr;
+  };
+
+  /** \brief put \p timer into the slot that covers its expiry, relative to m_currentTick
+   */
+  void
+  link(WheelTimer& timer);
+
+  void
+  append(size_t slot, WheelTimer& timer);
+
+  void
+  unlink(WheelTimer& timer);
+
+  /** \brief move timers in slot \p index of \p level to lower levels
+   */
+  void
+  cascade(size_t level, size_t index);
+
+  /** \brief fire all timers in \p slot, including those added to it by the callbacks
+   */
+  void
+  fire(size_t slot);
+
+  /** \brief process all ticks up to the current time
+   */
+  void
+  advance();
+
+  /** \brief ensure the driver event fires no later than computeNextTick()
+   */
+  void
+  updateDriver();
+
+private:
+  Scheduler& m_scheduler;
+  /// N_SLOTS slots per level, followed by DUE_SLOT for timers that were due when armed
+  Slot m_slots[N_LEVELS * N_SLOTS + 1];
+  /// bit i of m_occupied[level] is set if slot i of level is not empty
+  uint64_t m_occupied[N_LEVELS] = {};
+  /// the next tick to be processed; all earlier ticks have been processed
+  uint64_t m_currentTick;
+  size_t m_size = 0;
+
+  scheduler::ScopedEventId m_driver;
+  uint64_t m_driverTick = NO_TICK;
+  bool m_isAdvancing = false;
+
+  friend class WheelTimer;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
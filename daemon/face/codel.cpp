@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "codel.hpp"
+
+#include <cmath>
+
+namespace nfd {
+namespace face {
+
+Codel::Codel(const Options& options)
+  : m_options(options)
+{
+  BOOST_ASSERT(m_options.interval > time::nanoseconds::zero());
+}
+
+bool
+Codel::isAboveTargetForInterval(time::nanoseconds sojournTime, size_t queueBytes,
+                                time::steady_clock::TimePoint now)
+{
+  if (sojournTime < m_options.target || queueBytes <= m_options.minQueueBytes) {
+    m_firstAboveTime = time::steady_clock::TimePoint::max();
+    return false;
+  }
+
+  if (m_firstAboveTime == time::steady_clock::TimePoint::max()) {
+    m_firstAboveTime = now + m_options.interval;
+    return false;
+  }
+  return now >= m_firstAboveTime;
+}
+
+time::steady_clock::TimePoint
+Codel::computeNextDropTime(time::steady_clock::TimePoint t) const
+{
+  return t + time::nanoseconds(static_cast<time::nanoseconds::rep>(
+                                 m_options.interval.count() / std::sqrt(m_count)));
+}
+
+bool
+Codel::shouldDrop(time::nanoseconds sojournTime, size_t queueBytes,
+                  time::steady_clock::TimePoint now)
+{
+  bool isAbove = this->isAboveTargetForInterval(sojournTime, queueBytes, now);
+
+  if (m_isDropping) {
+    if (!isAbove) {
+      // sojourn time went below target: leave dropping state
+      m_isDropping = false;
+      return false;
+    }
+    if (now < m_dropNext) {
+      return false;
+    }
+    ++m_count;
+    m_dropNext = this->computeNextDropTime(m_dropNext);
+    return true;
+  }
+
+  if (!isAbove) {
+    return false;
+  }
+
+  // enter dropping state; if it was left recently, resume at a drop rate close to
+  // the one that controlled the queue last time
+  m_isDropping = true;
+  size_t delta = m_count - m_lastCount;
+  if (delta > 1 && now - m_dropNext < 16 * m_options.interval) {
+    m_count = delta;
+  }
+  else {
+    m_count = 1;
+  }
+  m_dropNext = this->computeNextDropTime(now);
+  m_lastCount = m_count;
+  return true;
+}
+
+} // namespace face
+} // namespace nfd
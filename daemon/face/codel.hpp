@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_CODEL_HPP
+#define NFD_DAEMON_FACE_CODEL_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace face {
+
+/** \brief CoDel active queue management of a packet queue
+ *
+ *  CoDel decides, whenever a packet leaves the queue, whether the packet should be dropped
+ *  (or marked), based on how long the packet has waited in the queue. Once the sojourn time
+ *  has stayed above the target for an interval, packets are dropped at a rate that increases
+ *  with the square root of the number of drops, until the sojourn time falls below the target.
+ *
+ *  \sa RFC 8289
+ */
+class Codel : noncopyable
+{
+public:
+  struct Options
+  {
+    /** \brief acceptable standing queue delay
+     */
+    time::nanoseconds target = 5_ms;
+
+    /** \brief period over which the sojourn time must stay above target before dropping starts,
+     *         on the order of a worst-case round-trip time
+     */
+    time::nanoseconds interval = 100_ms;
+
+    /** \brief no packet is dropped while the queue holds no more than this many octets
+     */
+    size_t minQueueBytes = ndn::MAX_NDN_PACKET_SIZE;
+  };
+
+  explicit
+  Codel(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief decide whether the packet leaving the queue should be dropped or marked
+   *  \param sojournTime time that the packet has spent in the queue
+   *  \param queueBytes octets in the queue, including the packet
+   *  \param now current time
+   *  \return true if the packet should be dropped or marked; if it's dropped,
+   *          this function should be called again for the next packet
+   */
+  bool
+  shouldDrop(time::nanoseconds sojournTime, size_t queueBytes, time::steady_clock::TimePoint now);
+
+  /** \return whether CoDel is dropping packets, because the sojourn time has stayed
+   *          above the target for an interval
+   */
+  bool
+  isDropping() const
+  {
+    return m_isDropping;
+  }
+
+private:
+  /** \return whether the sojourn time has stayed above the target for an interval
+   */
+  bool
+  isAboveTargetForInterval(time::nanoseconds sojournTime, size_t queueBytes,
+                           time::steady_clock::TimePoint now);
+
+  time::steady_clock::TimePoint
+  computeNextDropTime(time::steady_clock::TimePoint t) const;
+
+private:
+  Options m_options;
+  bool m_isDropping = false;
+  /// time when the sojourn time will have stayed above the target for an interval,
+  /// or TimePoint::max() if the sojourn time is below the target
+  time::steady_clock::TimePoint m_firstAboveTime = time::steady_clock::TimePoint::max();
+  time::steady_clock::TimePoint m_dropNext;
+  /// number of drops since entering the dropping state
+  size_t m_count = 0;
+  /// value of m_count when the dropping state was last entered
+  size_t m_lastCount = 0;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_CODEL_HPP
@@ -27,10 +27,21 @@
 #define NFD_DAEMON_FACE_DATAGRAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "io-thread.hpp"
+#include "receive-buffer-pool.hpp"
 #include "socket-utils.hpp"
 #include "common/global.hpp"
+#include "common/spsc-ring.hpp"
 
 #include <array>
+#include <atomic>
+
+#include <unistd.h> // for close()
+
+#ifdef __linux__
+#include <cerrno>       // for errno
+#include <sys/socket.h> // for recvmmsg() and sendmmsg()
+#endif // __linux__
 
 namespace nfd {
 namespace face {
@@ -38,32 +49,127 @@ namespace face {
 struct Unicast {};
 struct Multicast {};
 
+/** \brief Counters provided by DatagramTransport.
+ *  \note The type name DatagramTransportCounters is an implementation detail.
+ *        Use DatagramTransport::Counters in public API.
+ */
+class DatagramTransportCounters : public virtual Transport::Counters
+{
+public:
+  /** \brief number of buckets in the receive batch size histogram
+   */
+  static constexpr size_t N_RECEIVE_BATCH_BUCKETS = 8;
+
+  /** \brief histogram of datagrams drained per socket readiness event in batched receive mode,
+   *         or per hand-off from the I/O thread when socket I/O is offloaded
+   *
+   *  Bucket \p i counts batches of [2^i, 2^(i+1)) datagrams; the last bucket also counts
+   *  all larger batches. The histogram stays empty when neither mode is enabled.
+   */
+  std::array<PacketCounter, N_RECEIVE_BATCH_BUCKETS> nReceiveBatches;
+
+  /** \brief number of incoming datagrams dropped by the I/O thread because the ring toward
+   *         the forwarding thread was full
+   */
+  PacketCounter nInRingDrops;
+
+  /** \brief number of outgoing packets dropped because the ring toward the I/O thread was full
+   */
+  PacketCounter nOutRingDrops;
+};
+
 /** \brief Implements Transport for datagram-based protocols.
  *
  *  \tparam Protocol a datagram-based protocol in Boost.Asio
  */
 template<class Protocol, class Addressing = Unicast>
 class DatagramTransport : public Transport
+                        , protected virtual DatagramTransportCounters
 {
 public:
   typedef Protocol protocol;
 
+  /** \brief Counters provided by DatagramTransport.
+   *  \sa DatagramTransportCounters
+   */
+  using Counters = DatagramTransportCounters;
+
   /** \brief Construct datagram transport.
    *
    *  \param socket Protocol-specific socket for the created transport
+   *  \param receiveBatchSize maximum number of datagrams read from the socket per readiness
+   *                          event; 1 disables batched receive. Batched receive requires
+   *                          recvmmsg(2) and is ignored on platforms that lack it.
+   *  \param sendBatchSize maximum number of packets coalesced into one sendmmsg(2) call;
+   *                       1 disables send coalescing. Coalesced packets are transmitted at the
+   *                       end of the current io_service turn or when the batch is full.
+   *                       Send coalescing is ignored on platforms that lack sendmmsg(2).
+   *  \param ioThread if not null, the socket must be connected, and its sends and receives are
+   *                  performed on \p ioThread; packets are exchanged with the forwarding thread
+   *                  over SpscRings. \p receiveBatchSize and \p sendBatchSize are then ignored.
+   *                  The subclass constructor must call offloadSocket() once it no longer needs
+   *                  m_socket. Offloading requires Boost 1.66 or later, and is ignored otherwise.
    */
   explicit
-  DatagramTransport(typename protocol::socket&& socket);
+  DatagramTransport(typename protocol::socket&& socket,
+                    size_t receiveBatchSize = 1, size_t sendBatchSize = 1,
+                    shared_ptr<IoThread> ioThread = nullptr);
+
+  ~DatagramTransport() override;
+
+  const Counters&
+  getCounters() const final;
+
+  /** \brief reports nInRingDrops, nOutRingDrops, and the buckets of nReceiveBatches
+   *
+   *  Bucket \p i of nReceiveBatches is reported as "nReceiveBatches/2^i".
+   */
+  void
+  reportExtendedCounters(const CounterReporter& report) const override;
 
   ssize_t
   getSendQueueLength() override;
 
+  /** \return maximum number of datagrams read from the socket per readiness event
+   */
+  size_t
+  getReceiveBatchSize() const
+  {
+    return m_receiveBatchSize;
+  }
+
+  /** \return maximum number of packets coalesced into one send system call
+   */
+  size_t
+  getSendBatchSize() const
+  {
+    return m_sendBatchSize;
+  }
+
+  /** \return the thread that performs socket I/O, or nullptr if it is done on the calling thread
+   */
+  const shared_ptr<IoThread>&
+  getIoThread() const
+  {
+    return m_ioThread;
+  }
+
   /** \brief Receive datagram, translate buffer into packet, deliver to parent class.
+   *
+   *  The datagram is copied out of \p buffer.
    */
   void
   receiveDatagram(const uint8_t* buffer, size_t nBytesReceived,
                   const boost::system::error_code& error);
 
+  /** \brief Receive datagram, translate buffer into packet, deliver to parent class.
+   *
+   *  The decoded packet shares ownership of \p buffer, which must not be modified afterwards.
+   */
+  void
+  receiveDatagram(const ndn::ConstBufferPtr& buffer, size_t nBytesReceived,
+                  const boost::system::error_code& error);
+
 protected:
   void
   doClose() override;
@@ -74,9 +180,39 @@ protected:
   void
   handleSend(const boost::system::error_code& error, size_t nBytesSent);
 
+  /** \brief direct coalesced packets to \p socket, and to \p destination if specified
+   *
+   *  By default, coalesced packets are sent on m_socket, which must be connected.
+   */
+  void
+  setSendBatchTarget(typename protocol::socket& socket,
+                     optional<typename protocol::endpoint> destination = nullopt);
+
+  /** \brief queue \p packet for coalesced transmission
+   *  \pre getSendBatchSize() > 1
+   */
+  void
+  enqueueSend(const Block& packet);
+
+  /** \brief transmit all coalesced packets
+   */
+  void
+  flushSendBatch();
+
+  /** \return total size of coalesced packets not yet handed to the socket (in octets)
+   */
+  size_t
+  getSendBatchBytes() const
+  {
+    return m_sendBatchBytes;
+  }
+
   void
   handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
 
+  void
+  handleReceiveBatch(const boost::system::error_code& error);
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -89,6 +225,14 @@ protected:
   static EndpointId
   makeEndpointId(const typename protocol::endpoint& ep);
 
+  /** \brief hand m_socket over to the I/O thread given to the constructor, if any
+   *
+   *  m_socket is closed on the forwarding thread afterwards; the socket descriptor is owned and
+   *  operated by the I/O thread only.
+   */
+  void
+  offloadSocket();
+
 protected:
   typename protocol::socket m_socket;
   typename protocol::endpoint m_sender;
@@ -96,15 +240,155 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  void
+  startReceive();
+
+  void
+  deliverDatagram(bool isOk, const Block& element, size_t nBytesReceived);
+
+  void
+  recordReceiveBatch(size_t nDatagrams);
+
+  /** \brief ensure \p buffer can be received into, i.e., no decoded packet refers to it
+   */
+  static void
+  renewReceiveBuffer(shared_ptr<ndn::Buffer>& buffer);
+
+  struct Offload;
+
+  /** \brief receive into offload->receiveBuffer and hand datagrams to the forwarding thread
+   *  \note called on the I/O thread
+   */
+  static void
+  startOffloadedReceive(const shared_ptr<Offload>& offload);
+
+  /** \brief send all packets handed over by the forwarding thread
+   *  \note called on the I/O thread
+   */
+  static void
+  flushOffloadedSends(const shared_ptr<Offload>& offload);
+
+  /** \brief report a socket error to the transport, if it still exists
+   *  \note called on the I/O thread
+   */
+  static void
+  reportOffloadedError(const shared_ptr<Offload>& offload, const boost::system::error_code& error);
+
+  /** \brief invoke \p f with the transport on the forwarding thread, if the transport
+   *         still exists at that time
+   *
+   *  The posted handler refers to \p offload weakly, so that the forwarding thread does not
+   *  keep the offloaded socket alive beyond the lifetime of the transport and the I/O thread.
+   */
+  template<typename F>
+  static void
+  postToTransport(const shared_ptr<Offload>& offload, F&& f);
+
+  /** \brief deliver datagrams handed over by the I/O thread
+   */
+  void
+  drainOffloadedReceives();
+
+  void
+  doSendOffloaded(const Block& packet);
+
+  void
+  doCloseOffloaded();
+
+private:
+  shared_ptr<ndn::Buffer> m_receiveBuffer;
   bool m_hasRecentlyReceived;
+  size_t m_receiveBatchSize;
+
+  size_t m_sendBatchSize;
+  std::vector<Block> m_sendBatch;
+  std::vector<Block> m_sendBatchInFlight;
+  size_t m_sendBatchBytes;
+  bool m_isSendFlushScheduled;
+  typename protocol::socket* m_sendBatchSocket;
+  optional<typename protocol::endpoint> m_sendBatchDestination;
+
+#ifdef __linux__
+  /** \brief state of batched receive, allocated only if m_receiveBatchSize > 1
+   *
+   *  In batched mode, datagrams are read into \p buffers rather than m_receiveBuffer.
+   */
+  struct ReceiveBatch
+  {
+    std::vector<shared_ptr<ndn::Buffer>> buffers;
+    std::vector<typename protocol::endpoint> senders;
+    std::vector<::iovec> iovecs;
+    std::vector<::mmsghdr> headers;
+  };
+  unique_ptr<ReceiveBatch> m_receiveBatch;
+
+  std::vector<::iovec> m_sendIovecs;
+  std::vector<::mmsghdr> m_sendHeaders;
+#endif // __linux__
+
+  struct ReceivedDatagram
+  {
+    shared_ptr<ndn::Buffer> buffer;
+    size_t size = 0;
+    typename protocol::endpoint sender;
+  };
+
+  /** \brief state shared between the transport and the I/O thread, allocated only if socket I/O
+   *         is offloaded
+   *
+   *  The I/O thread refers to this state rather than the transport, because the transport may
+   *  be destroyed while operations are outstanding on the I/O thread. \p transport is accessed
+   *  only on the forwarding thread, and is reset when the transport is destroyed.
+   */
+  struct Offload
+  {
+    Offload(DatagramTransport* transport, boost::asio::io_service& ioThreadIo)
+      : transport(transport)
+      , mainIo(getGlobalIoService())
+      , socket(ioThreadIo)
+      , receiveRing(RING_CAPACITY)
+      , sendRing(RING_CAPACITY)
+    {
+    }
+
+    static constexpr size_t RING_CAPACITY = 1024;
+
+    DatagramTransport* transport;
+    boost::asio::io_service& mainIo; ///< io_service of the forwarding thread
+    /// the transport's socket after offloadSocket(), operated on the I/O thread
+    typename protocol::socket socket;
+    /// length of the socket's send queue, sampled by the I/O thread after each flush
+    std::atomic<ssize_t> socketQueueLength{0};
+
+    SpscRing<ReceivedDatagram> receiveRing; ///< I/O thread to forwarding thread
+    std::atomic<bool> isReceiveDrainScheduled{false};
+    std::atomic<uint64_t> nReceiveRingDrops{0};
+    shared_ptr<ndn::Buffer> receiveBuffer;   ///< accessed only on the I/O thread
+    typename protocol::endpoint sender;     ///< accessed only on the I/O thread
+
+    SpscRing<Block> sendRing; ///< forwarding thread to I/O thread
+    std::atomic<bool> isSendFlushScheduled{false};
+    /// octets handed to the I/O thread whose send has not completed
+    std::atomic<size_t> nSendBytes{0};
+  };
+
+  // m_ioThread is declared before m_offload, so that it is released after m_offload
+  shared_ptr<IoThread> m_ioThread;
+  shared_ptr<Offload> m_offload;
 };
 
 
 template<class T, class U>
-DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket)
+DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket,
+                                           size_t receiveBatchSize, size_t sendBatchSize,
+                                           shared_ptr<IoThread> ioThread)
   : m_socket(std::move(socket))
   , m_hasRecentlyReceived(false)
+  , m_receiveBatchSize(1)
+  , m_sendBatchSize(1)
+  , m_sendBatchBytes(0)
+  , m_isSendFlushScheduled(false)
+  , m_sendBatchSocket(&m_socket)
 {
   boost::asio::socket_base::send_buffer_size sendBufferSizeOption;
   boost::system::error_code error;
@@ -116,21 +400,136 @@ DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol:
   else {
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
+  // reading the queue length from the socket is a system call
+  this->setSendQueueSamplingInterval(SOCKET_SEND_QUEUE_SAMPLING_INTERVAL);
 
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
-                              [this] (auto&&... args) {
-                                this->handleReceive(std::forward<decltype(args)>(args)...);
-                              });
+  if (ioThread != nullptr) {
+#if BOOST_VERSION >= 106600
+    // the socket is handed over in offloadSocket(), after the subclass has finished using it
+    m_offload = make_shared<Offload>(this, ioThread->getIoService());
+    m_ioThread = std::move(ioThread);
+    return;
+#else
+    NFD_LOG_FACE_WARN("Offloading socket I/O requires Boost 1.66 or later");
+#endif // BOOST_VERSION >= 106600
+  }
+
+#ifdef __linux__
+  if (receiveBatchSize > 1) {
+    m_receiveBatchSize = receiveBatchSize;
+    m_receiveBatch = make_unique<ReceiveBatch>();
+    m_receiveBatch->buffers.resize(m_receiveBatchSize);
+    m_receiveBatch->senders.resize(m_receiveBatchSize);
+    m_receiveBatch->iovecs.resize(m_receiveBatchSize);
+    m_receiveBatch->headers.resize(m_receiveBatchSize);
+  }
+
+  if (sendBatchSize > 1) {
+    m_sendBatchSize = sendBatchSize;
+    m_sendBatch.reserve(m_sendBatchSize);
+    m_sendIovecs.resize(m_sendBatchSize);
+    m_sendHeaders.resize(m_sendBatchSize);
+  }
+#endif // __linux__
+
+  startReceive();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::offloadSocket()
+{
+#if BOOST_VERSION >= 106600
+  if (m_offload == nullptr) {
+    return;
+  }
+
+  boost::system::error_code error;
+  auto protocol = m_socket.local_endpoint(error).protocol();
+  int fd = error ? -1 : m_socket.release(error);
+  if (error) {
+    NFD_LOG_FACE_WARN("Failed to hand socket over to I/O thread: " << error.message());
+    m_offload.reset();
+    m_ioThread.reset();
+    startReceive();
+    return;
+  }
+
+  NFD_LOG_FACE_DEBUG("Offloading socket I/O to I/O thread " << m_ioThread->getIndex());
+  // the descriptor is attached on the I/O thread, which operates the socket from now on;
+  // sends and closure are posted after this handler, and therefore see the attached socket
+  m_ioThread->getIoService().post([offload = m_offload, protocol, fd] {
+    boost::system::error_code error;
+    offload->socket.assign(protocol, fd, error);
+    if (error) {
+      ::close(fd);
+      reportOffloadedError(offload, error);
+      return;
+    }
+    startOffloadedReceive(offload);
+  });
+#endif // BOOST_VERSION >= 106600
+}
+
+template<class T, class U>
+DatagramTransport<T, U>::~DatagramTransport()
+{
+  if (m_offload == nullptr) {
+    return;
+  }
+
+  // stop delivering to this transport, and make sure that the I/O thread stops using the socket
+  // even if the transport is destroyed without being closed
+  m_offload->transport = nullptr;
+  m_ioThread->getIoService().post([offload = m_offload] {
+    boost::system::error_code error;
+    offload->socket.close(error);
+  });
+}
+
+template<class T, class U>
+const typename DatagramTransport<T, U>::Counters&
+DatagramTransport<T, U>::getCounters() const
+{
+  return *this;
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::reportExtendedCounters(const CounterReporter& report) const
+{
+  for (size_t i = 0; i < N_RECEIVE_BATCH_BUCKETS; ++i) {
+    report("nReceiveBatches/" + to_string(size_t(1) << i), nReceiveBatches[i]);
+  }
+  report("nInRingDrops", nInRingDrops);
+  report("nOutRingDrops", nOutRingDrops);
 }
 
 template<class T, class U>
 ssize_t
 DatagramTransport<T, U>::getSendQueueLength()
 {
+  if (m_offload != nullptr) {
+    // the socket belongs to the I/O thread; packets handed to it are queued as much as
+    // those in the socket buffer
+    ssize_t queueLength = m_offload->socketQueueLength.load(std::memory_order_relaxed);
+    if (queueLength >= 0) {
+      queueLength += m_offload->nSendBytes.load(std::memory_order_relaxed);
+    }
+    return queueLength;
+  }
+
+  if (!m_socket.is_open()) {
+    return QUEUE_ERROR;
+  }
+
   ssize_t queueLength = getTxQueueLength(m_socket.native_handle());
   if (queueLength == QUEUE_ERROR) {
     NFD_LOG_FACE_WARN("Failed to obtain send queue length from socket: " << std::strerror(errno));
   }
+  else if (queueLength >= 0) {
+    queueLength += m_sendBatchBytes;
+  }
   return queueLength;
 }
 
@@ -140,6 +539,14 @@ DatagramTransport<T, U>::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (m_offload != nullptr) {
+    doCloseOffloaded();
+    return;
+  }
+
+  // hand coalesced packets to the socket before it goes away
+  flushSendBatch();
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
     // Use the non-throwing variants and ignore errors, if any.
@@ -161,6 +568,16 @@ DatagramTransport<T, U>::doSend(const Block& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (m_offload != nullptr) {
+    doSendOffloaded(packet);
+    return;
+  }
+
+  if (m_sendBatchSize > 1) {
+    enqueueSend(packet);
+    return;
+  }
+
   m_socket.async_send(boost::asio::buffer(packet),
                       // 'packet' is copied into the lambda to retain the underlying Buffer
                       [this, packet] (auto&&... args) {
@@ -168,6 +585,109 @@ DatagramTransport<T, U>::doSend(const Block& packet)
                       });
 }
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::setSendBatchTarget(typename protocol::socket& socket,
+                                            optional<typename protocol::endpoint> destination)
+{
+  m_sendBatchSocket = &socket;
+  m_sendBatchDestination = std::move(destination);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::enqueueSend(const Block& packet)
+{
+  BOOST_ASSERT(m_sendBatchSize > 1);
+
+  m_sendBatch.push_back(packet);
+  m_sendBatchBytes += packet.size();
+
+  if (m_sendBatch.size() >= m_sendBatchSize) {
+    flushSendBatch();
+  }
+  else if (!m_isSendFlushScheduled) {
+    // transmit whatever has been queued once the current io_service turn is over
+    m_isSendFlushScheduled = true;
+    getGlobalIoService().post([this] {
+      m_isSendFlushScheduled = false;
+      this->flushSendBatch();
+    });
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::flushSendBatch()
+{
+  if (m_sendBatch.empty()) {
+    return;
+  }
+
+  // m_sendBatch is emptied before anything is sent, in case an error closes the transport
+  // and causes reentrance through doClose
+  BOOST_ASSERT(m_sendBatchInFlight.empty());
+  m_sendBatchInFlight.swap(m_sendBatch);
+  m_sendBatchBytes = 0;
+  auto& batch = m_sendBatchInFlight;
+
+  auto& socket = *m_sendBatchSocket;
+  if (!socket.is_open()) {
+    batch.clear();
+    return;
+  }
+
+  size_t nSent = 0;
+#ifdef __linux__
+  for (size_t i = 0; i < batch.size(); ++i) {
+    m_sendIovecs[i].iov_base = const_cast<uint8_t*>(batch[i].wire());
+    m_sendIovecs[i].iov_len = batch[i].size();
+    auto& hdr = m_sendHeaders[i].msg_hdr;
+    hdr = {};
+    if (m_sendBatchDestination) {
+      hdr.msg_name = const_cast<void*>(static_cast<const void*>(m_sendBatchDestination->data()));
+      hdr.msg_namelen = m_sendBatchDestination->size();
+    }
+    hdr.msg_iov = &m_sendIovecs[i];
+    hdr.msg_iovlen = 1;
+  }
+
+  while (nSent < batch.size() && socket.is_open()) {
+    int n = ::sendmmsg(socket.native_handle(), &m_sendHeaders[nSent],
+                       static_cast<unsigned int>(batch.size() - nSent), MSG_DONTWAIT);
+    if (n >= 0) {
+      NFD_LOG_FACE_TRACE("Successfully sent: " << n << " packets in one batch");
+      nSent += static_cast<size_t>(n);
+    }
+    else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      // socket buffer is full, let Boost.Asio wait for the socket to become writable
+      break;
+    }
+    else if (errno != EINTR) {
+      // skip the packet that triggered the error and continue with the rest of the batch
+      processErrorCode(boost::system::error_code(errno, boost::system::system_category()));
+      ++nSent;
+    }
+  }
+#endif // __linux__
+
+  for (size_t i = nSent; i < batch.size() && socket.is_open(); ++i) {
+    const Block& packet = batch[i];
+    auto handler = [this, packet] (auto&&... args) {
+      this->handleSend(std::forward<decltype(args)>(args)...);
+    };
+    if (m_sendBatchDestination) {
+      socket.async_send_to(boost::asio::buffer(packet), *m_sendBatchDestination, handler);
+    }
+    else {
+      socket.async_send(boost::asio::buffer(packet), handler);
+    }
+  }
+
+  // clear() retains the capacity, so that the next flush does not allocate
+  batch.clear();
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::receiveDatagram(const uint8_t* buffer, size_t nBytesReceived,
@@ -176,11 +696,34 @@ DatagramTransport<T, U>::receiveDatagram(const uint8_t* buffer, size_t nBytesRec
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes from " << m_sender);
-
   bool isOk = false;
   Block element;
   std::tie(isOk, element) = Block::fromBuffer(buffer, nBytesReceived);
+  deliverDatagram(isOk, element, nBytesReceived);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::receiveDatagram(const ndn::ConstBufferPtr& buffer, size_t nBytesReceived,
+                                         const boost::system::error_code& error)
+{
+  if (error)
+    return processErrorCode(error);
+
+  // Bytes past nBytesReceived are stale, but any element that extends into them
+  // is rejected by the size check in deliverDatagram.
+  bool isOk = false;
+  Block element;
+  std::tie(isOk, element) = Block::fromBuffer(buffer, 0);
+  deliverDatagram(isOk, element, nBytesReceived);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::deliverDatagram(bool isOk, const Block& element, size_t nBytesReceived)
+{
+  NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes from " << m_sender);
+
   if (!isOk) {
     NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << m_sender);
     // This packet won't extend the face lifetime
@@ -196,17 +739,270 @@ DatagramTransport<T, U>::receiveDatagram(const uint8_t* buffer, size_t nBytesRec
   this->receive(element, makeEndpointId(m_sender));
 }
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::renewReceiveBuffer(shared_ptr<ndn::Buffer>& buffer)
+{
+  if (buffer == nullptr || buffer.use_count() > 1) {
+    buffer = getReceiveBufferPool().acquire();
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::startReceive()
+{
+  if (m_receiveBatchSize > 1) {
+    // wait for readiness only, and then drain the socket with recvmmsg() in handleReceiveBatch
+    m_socket.async_receive(boost::asio::null_buffers(),
+                           [this] (const boost::system::error_code& error, size_t) {
+                             this->handleReceiveBatch(error);
+                           });
+    return;
+  }
+
+  renewReceiveBuffer(m_receiveBuffer);
+  m_socket.async_receive_from(boost::asio::buffer(*m_receiveBuffer), m_sender,
+                              [this] (auto&&... args) {
+                                this->handleReceive(std::forward<decltype(args)>(args)...);
+                              });
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, size_t nBytesReceived)
 {
-  receiveDatagram(m_receiveBuffer.data(), nBytesReceived, error);
+  receiveDatagram(m_receiveBuffer, nBytesReceived, error);
+
+  if (m_socket.is_open())
+    startReceive();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleReceiveBatch(const boost::system::error_code& error)
+{
+#ifdef __linux__
+  if (error) {
+    processErrorCode(error);
+  }
+  else {
+    for (size_t i = 0; i < m_receiveBatchSize; ++i) {
+      auto& buffer = m_receiveBatch->buffers[i];
+      renewReceiveBuffer(buffer);
+      m_receiveBatch->iovecs[i].iov_base = buffer->data();
+      m_receiveBatch->iovecs[i].iov_len = buffer->size();
+
+      auto& hdr = m_receiveBatch->headers[i].msg_hdr;
+      hdr = {};
+      hdr.msg_name = m_receiveBatch->senders[i].data();
+      hdr.msg_namelen = m_receiveBatch->senders[i].capacity();
+      hdr.msg_iov = &m_receiveBatch->iovecs[i];
+      hdr.msg_iovlen = 1;
+      m_receiveBatch->headers[i].msg_len = 0;
+    }
+
+    int nReceived = ::recvmmsg(m_socket.native_handle(), m_receiveBatch->headers.data(),
+                               static_cast<unsigned int>(m_receiveBatchSize), MSG_DONTWAIT, nullptr);
+    if (nReceived < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        processErrorCode(boost::system::error_code(errno, boost::system::system_category()));
+      }
+    }
+    else {
+      recordReceiveBatch(static_cast<size_t>(nReceived));
+      // let the forwarder process the datagrams of one read as a batch
+      bool isBurst = nReceived > 1;
+      if (isBurst)
+        this->beginReceiveBurst();
+      for (int i = 0; i < nReceived && m_socket.is_open(); ++i) {
+        m_receiveBatch->senders[i].resize(m_receiveBatch->headers[i].msg_hdr.msg_namelen);
+        m_sender = m_receiveBatch->senders[i];
+        receiveDatagram(m_receiveBatch->buffers[i], m_receiveBatch->headers[i].msg_len, {});
+      }
+      if (isBurst)
+        this->endReceiveBurst();
+    }
+  }
 
   if (m_socket.is_open())
-    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
-                                [this] (auto&&... args) {
-                                  this->handleReceive(std::forward<decltype(args)>(args)...);
-                                });
+    startReceive();
+#else
+  BOOST_ASSERT_MSG(false, "batched receive is not supported on this platform");
+#endif // __linux__
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::recordReceiveBatch(size_t nDatagrams)
+{
+  if (nDatagrams == 0) {
+    return;
+  }
+
+  size_t bucket = 0;
+  while ((nDatagrams >>= 1) > 0 && bucket < N_RECEIVE_BATCH_BUCKETS - 1) {
+    ++bucket;
+  }
+  ++nReceiveBatches[bucket];
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::startOffloadedReceive(const shared_ptr<Offload>& offload)
+{
+  renewReceiveBuffer(offload->receiveBuffer);
+  offload->socket.async_receive_from(boost::asio::buffer(*offload->receiveBuffer), offload->sender,
+    [offload] (const boost::system::error_code& error, size_t nBytesReceived) {
+      if (error) {
+        reportOffloadedError(offload, error);
+      }
+      else {
+        ReceivedDatagram datagram{std::move(offload->receiveBuffer), nBytesReceived, offload->sender};
+        if (!offload->receiveRing.tryPush(std::move(datagram))) {
+          // the forwarding thread is not keeping up; drop the datagram as a full socket buffer
+          // would, and receive the next one into the same buffer
+          offload->receiveBuffer = std::move(datagram.buffer);
+          offload->nReceiveRingDrops.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!offload->isReceiveDrainScheduled.exchange(true)) {
+          postToTransport(offload, [] (DatagramTransport& transport) {
+            transport.drainOffloadedReceives();
+          });
+        }
+      }
+
+      if (offload->socket.is_open()) {
+        startOffloadedReceive(offload);
+      }
+    });
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::flushOffloadedSends(const shared_ptr<Offload>& offload)
+{
+  // clear the flag before draining, so that packets pushed from now on schedule another flush
+  offload->isSendFlushScheduled.store(false);
+
+  Block packet;
+  while (offload->sendRing.tryPop(packet)) {
+    if (!offload->socket.is_open()) {
+      offload->nSendBytes.fetch_sub(packet.size(), std::memory_order_relaxed);
+      continue;
+    }
+
+    offload->socket.async_send(boost::asio::buffer(packet),
+      // 'packet' is copied into the lambda to retain the underlying Buffer
+      [offload, packet] (const boost::system::error_code& error, size_t) {
+        offload->nSendBytes.fetch_sub(packet.size(), std::memory_order_relaxed);
+        if (error) {
+          reportOffloadedError(offload, error);
+        }
+      });
+  }
+
+  if (offload->socket.is_open()) {
+    offload->socketQueueLength.store(getTxQueueLength(offload->socket.native_handle()),
+                                     std::memory_order_relaxed);
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::reportOffloadedError(const shared_ptr<Offload>& offload,
+                                             const boost::system::error_code& error)
+{
+  if (error == boost::asio::error::operation_aborted) {
+    return;
+  }
+
+  postToTransport(offload, [error] (DatagramTransport& transport) {
+    transport.processErrorCode(error);
+  });
+}
+
+template<class T, class U>
+template<typename F>
+void
+DatagramTransport<T, U>::postToTransport(const shared_ptr<Offload>& offload, F&& f)
+{
+  offload->mainIo.post([weakOffload = weak_ptr<Offload>(offload), f = std::forward<F>(f)] {
+    auto offload = weakOffload.lock();
+    if (offload != nullptr && offload->transport != nullptr) {
+      f(*offload->transport);
+    }
+  });
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::drainOffloadedReceives()
+{
+  // clear the flag before draining, so that datagrams pushed from now on schedule another drain
+  m_offload->isReceiveDrainScheduled.store(false);
+  nInRingDrops += m_offload->nReceiveRingDrops.exchange(0, std::memory_order_relaxed);
+
+  // at most one ring's worth is delivered per drain, so that a busy I/O thread
+  // cannot starve other work on the forwarding thread
+  auto& ring = m_offload->receiveRing;
+  ReceivedDatagram datagram;
+  size_t nDrained = 0;
+  this->beginReceiveBurst();
+  while (nDrained < ring.capacity() && ring.tryPop(datagram)) {
+    ++nDrained;
+    if (getState() != TransportState::UP) {
+      // transport is shutting down, discard
+      continue;
+    }
+    m_sender = datagram.sender;
+    receiveDatagram(datagram.buffer, datagram.size, {});
+  }
+  this->endReceiveBurst();
+  recordReceiveBatch(nDrained);
+
+  if (!ring.empty() && !m_offload->isReceiveDrainScheduled.exchange(true)) {
+    postToTransport(m_offload, [] (DatagramTransport& transport) {
+      transport.drainOffloadedReceives();
+    });
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::doSendOffloaded(const Block& packet)
+{
+  size_t size = packet.size();
+  // counted before the hand-off, so that the I/O thread never subtracts first
+  m_offload->nSendBytes.fetch_add(size, std::memory_order_relaxed);
+  if (!m_offload->sendRing.tryPush(Block(packet))) {
+    m_offload->nSendBytes.fetch_sub(size, std::memory_order_relaxed);
+    ++nOutRingDrops;
+    NFD_LOG_FACE_DEBUG("Send ring to I/O thread is full, dropping packet");
+    return;
+  }
+
+  if (!m_offload->isSendFlushScheduled.exchange(true)) {
+    m_ioThread->getIoService().post([offload = m_offload] { flushOffloadedSends(offload); });
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::doCloseOffloaded()
+{
+  // The socket is closed on the I/O thread after the packets queued so far have been
+  // handed to it. The transport becomes CLOSED only after that, and after the forwarding thread
+  // has processed whatever the I/O thread posted before the socket was closed.
+  m_ioThread->getIoService().post([offload = m_offload] {
+    flushOffloadedSends(offload);
+    boost::system::error_code error;
+    offload->socket.close(error);
+
+    postToTransport(offload, [] (DatagramTransport& transport) {
+      transport.setState(TransportState::CLOSED);
+    });
+  });
 }
 
 template<class T, class U>
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "egress-scheduler.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+namespace face {
+
+EgressScheduler::EgressScheduler(const Options& options)
+{
+  setOptions(options);
+}
+
+void
+EgressScheduler::setOptions(const Options& options)
+{
+  BOOST_ASSERT(options.quantum > 0);
+  m_options = options;
+}
+
+EgressScheduler::FlowKey
+EgressScheduler::classify(uint32_t packetType, const Name& name) const
+{
+  size_t prefixLength = std::min(m_options.flowPrefixLength, name.size());
+  return {packetType, name.getPrefix(static_cast<ssize_t>(prefixLength))};
+}
+
+void
+EgressScheduler::enqueue(const FlowKey& key, Item item)
+{
+  auto it = m_flows.find(key);
+  if (it == m_flows.end()) {
+    it = m_flows.emplace(key, Flow()).first;
+    m_activeFlows.push_back(it);
+    if (m_activeFlows.size() == 1) {
+      startTurn();
+    }
+  }
+
+  Flow& flow = it->second;
+  flow.nBytes += item.size;
+  m_nQueuedBytes += item.size;
+  ++m_nQueuedPackets;
+  flow.queue.push_back(std::move(item));
+}
+
+EgressScheduler::Item
+EgressScheduler::dequeue()
+{
+  BOOST_ASSERT(!empty());
+
+  while (true) {
+    auto it = m_activeFlows.front();
+    Flow& flow = it->second;
+    size_t headSize = flow.queue.front().size;
+    if (flow.deficit >= headSize) {
+      flow.deficit -= headSize;
+      return popFromFlow(it);
+    }
+
+    // the deficit does not cover the head packet: the next flow takes its turn
+    m_activeFlows.pop_front();
+    m_activeFlows.push_back(it);
+    startTurn();
+  }
+}
+
+EgressScheduler::Item
+EgressScheduler::dropFromLongestFlow()
+{
+  BOOST_ASSERT(!empty());
+
+  auto longest = std::max_element(m_activeFlows.begin(), m_activeFlows.end(),
+                                  [] (const auto& a, const auto& b) {
+                                    return a->second.nBytes < b->second.nBytes;
+                                  });
+  return popFromFlow(*longest);
+}
+
+EgressScheduler::Item
+EgressScheduler::popFromFlow(FlowMap::iterator it)
+{
+  Flow& flow = it->second;
+  Item item = std::move(flow.queue.front());
+  flow.queue.pop_front();
+  flow.nBytes -= item.size;
+  m_nQueuedBytes -= item.size;
+  --m_nQueuedPackets;
+
+  if (flow.queue.empty()) {
+    // an idle flow does not keep its deficit
+    bool isFront = m_activeFlows.front() == it;
+    m_activeFlows.erase(std::find(m_activeFlows.begin(), m_activeFlows.end(), it));
+    m_flows.erase(it);
+    if (isFront && !m_activeFlows.empty()) {
+      startTurn();
+    }
+  }
+  return item;
+}
+
+void
+EgressScheduler::startTurn()
+{
+  m_activeFlows.front()->second.deficit += m_options.quantum;
+}
+
+} // namespace face
+} // namespace nfd
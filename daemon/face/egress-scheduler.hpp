@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
+#define NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
+
+#include "face-common.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+#include <deque>
+#include <tuple>
+
+namespace nfd {
+namespace face {
+
+/** \brief holds outgoing network-layer packets in per-flow queues and serves them with
+ *         deficit round robin
+ *
+ *  A flow is identified by the packet type and the first few components of the name.
+ *  Each time a backlogged flow's turn comes, its deficit is increased by
+ *  a quantum, and it may send packets as long as their size is covered by the deficit.
+ *  Therefore, backlogged flows share the link equally in octets, and a flow that sends
+ *  occasional small packets is served within one round instead of waiting behind bulk flows.
+ *
+ *  \sa M. Shreedhar and G. Varghese, "Efficient fair queuing using deficit round-robin,"
+ *      IEEE/ACM Transactions on Networking, 1996
+ */
+class EgressScheduler : noncopyable
+{
+public:
+  /** \brief Options that control the behavior of EgressScheduler
+   */
+  struct Options
+  {
+    /** \brief number of leading name components that, together with the packet type,
+     *         identify a flow
+     *
+     *  If zero, all packets of the same type belong to one flow.
+     */
+    size_t flowPrefixLength = 1;
+
+    /** \brief octets added to the deficit of a flow in each round
+     */
+    size_t quantum = ndn::MAX_NDN_PACKET_SIZE;
+
+    /** \brief maximum number of octets held in all flows
+     *
+     *  When this is exceeded, packets are dropped from the head of the longest flow.
+     */
+    size_t capacity = 1048576;
+
+    /** \brief packets are held in the scheduler while the transport send queue length
+     *         exceeds this number of octets
+     */
+    size_t transportQueueTarget = 65536;
+  };
+
+  /** \brief identifies a flow
+   */
+  struct FlowKey
+  {
+    /// TLV-TYPE of the network-layer packet, or lp::tlv::Nack
+    uint32_t packetType;
+    /// name prefix of the packets in the flow
+    Name prefix;
+  };
+
+  /** \brief a network-layer packet waiting in a flow queue
+   */
+  struct Item
+  {
+    lp::Packet packet;
+    bool isInterest;
+    size_t size;
+  };
+
+  explicit
+  EgressScheduler(const Options& options);
+
+  /** \brief set options for scheduler
+   *
+   *  Packets already queued stay in their flows.
+   */
+  void
+  setOptions(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief determine the flow of an outgoing packet
+   *  \param packetType TLV-TYPE of the network-layer packet, or lp::tlv::Nack
+   *  \param name name of the Interest, Data, or Nack
+   */
+  FlowKey
+  classify(uint32_t packetType, const Name& name) const;
+
+  /** \brief append a packet to the queue of its flow
+   */
+  void
+  enqueue(const FlowKey& key, Item item);
+
+  /** \brief remove the next packet according to deficit round robin
+   *  \pre !empty()
+   */
+  Item
+  dequeue();
+
+  /** \return whether the queued packets exceed the capacity
+   */
+  bool
+  isOverCapacity() const
+  {
+    return m_nQueuedBytes > m_options.capacity;
+  }
+
+  /** \brief remove the packet at the head of the flow that has the most queued octets
+   *  \pre !empty()
+   */
+  Item
+  dropFromLongestFlow();
+
+  bool
+  empty() const
+  {
+    return m_activeFlows.empty();
+  }
+
+  /** \return number of queued packets
+   */
+  size_t
+  size() const
+  {
+    return m_nQueuedPackets;
+  }
+
+  /** \return number of queued octets
+   */
+  size_t
+  getQueuedBytes() const
+  {
+    return m_nQueuedBytes;
+  }
+
+  /** \return number of flows that have queued packets
+   */
+  size_t
+  getNFlows() const
+  {
+    return m_activeFlows.size();
+  }
+
+private:
+  struct FlowKeyLess
+  {
+    bool
+    operator()(const FlowKey& a, const FlowKey& b) const
+    {
+      return std::tie(a.packetType, a.prefix) < std::tie(b.packetType, b.prefix);
+    }
+  };
+
+  struct Flow
+  {
+    std::deque<Item> queue;
+    size_t nBytes = 0;
+    size_t deficit = 0;
+  };
+
+  using FlowMap = std::map<FlowKey, Flow, FlowKeyLess>;
+
+  /** \brief remove the head packet of a flow, and erase the flow if it becomes empty
+   */
+  Item
+  popFromFlow(FlowMap::iterator it);
+
+  /** \brief give the flow at the front of the round its quantum
+   */
+  void
+  startTurn();
+
+private:
+  Options m_options;
+  FlowMap m_flows;
+  /// flows that have queued packets, in round-robin order; the front flow is being served
+  std::deque<FlowMap::iterator> m_activeFlows;
+  size_t m_nQueuedPackets = 0;
+  size_t m_nQueuedBytes = 0;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
@@ -39,12 +39,14 @@ namespace face {
 NFD_LOG_INIT(EthernetChannel);
 
 EthernetChannel::EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                                 time::nanoseconds idleTimeout)
+                                 time::nanoseconds idleTimeout,
+                                 EthernetIoBackend ioBackend)
   : m_localEndpoint(std::move(localEndpoint))
   , m_isListening(false)
   , m_socket(getGlobalIoService())
   , m_pcap(m_localEndpoint->getName())
   , m_idleFaceTimeout(idleTimeout)
+  , m_ioBackend(ioBackend)
 #ifdef _DEBUG
   , m_nDropped(0)
 #endif
@@ -207,7 +209,8 @@ EthernetChannel::createFace(const ethernet::Address& remoteEndpoint,
 
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<UnicastEthernetTransport>(*m_localEndpoint, remoteEndpoint,
-                                                         params.persistency, m_idleFaceTimeout);
+                                                         params.persistency, m_idleFaceTimeout,
+                                                         m_ioBackend);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
   face->setChannel(shared_from_this()); // use weak_from_this() in C++17
 
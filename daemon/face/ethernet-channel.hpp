@@ -28,6 +28,7 @@
 
 #include "channel.hpp"
 #include "ethernet-protocol.hpp"
+#include "ethernet-transport.hpp"
 #include "pcap-helper.hpp"
 #include <ndn-cxx/net/network-interface.hpp>
 
@@ -58,9 +59,13 @@ public:
    *
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call EthernetChannel::listen method.
+   *
+   * \param ioBackend mechanism used by the transports of faces created by this channel;
+   *                  the channel itself always listens with libpcap
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  EthernetIoBackend ioBackend = EthernetIoBackend::PCAP);
 
   bool
   isListening() const override
@@ -129,6 +134,7 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const EthernetIoBackend m_ioBackend;
 
 #ifdef _DEBUG
   /// number of frames dropped by the kernel, as reported by libpcap
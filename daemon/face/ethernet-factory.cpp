@@ -60,6 +60,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   // {
   //   listen yes
   //   idle_timeout 600
+  //   io_backend pcap
   //   mcast yes
   //   mcast_group 01:00:5E:00:17:AA
   //   mcast_ad_hoc no
@@ -74,6 +75,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
 
   UnicastConfig unicastConfig;
   MulticastConfig mcastConfig;
+  EthernetIoBackend ioBackend = EthernetIoBackend::PCAP;
 
   if (configSection) {
     // listen and mcast default to 'yes' but only if face_system.ether section is present
@@ -89,6 +91,24 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         unicastConfig.idleTimeout = time::seconds(ConfigFile::parseNumber<uint32_t>(pair, "face_system.ether"));
       }
+      else if (key == "io_backend") {
+        const std::string& valueStr = value.get_value<std::string>();
+        if (valueStr == "pcap") {
+          ioBackend = EthernetIoBackend::PCAP;
+        }
+        else if (valueStr == "packet_mmap") {
+#ifdef __linux__
+          ioBackend = EthernetIoBackend::PACKET_MMAP;
+#else
+          NDN_THROW(ConfigFile::Error("face_system.ether.io_backend: 'packet_mmap' is only "
+                                      "supported on Linux"));
+#endif
+        }
+        else {
+          NDN_THROW(ConfigFile::Error("face_system.ether.io_backend: '" + valueStr +
+                                      "' is not a supported I/O backend"));
+        }
+      }
       else if (key == "mcast") {
         mcastConfig.isEnabled = ConfigFile::parseYesNo(pair, "face_system.ether");
       }
@@ -136,6 +156,13 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     NFD_LOG_WARN("Cannot disable Ethernet channels after initialization");
   }
 
+  if (m_ioBackend != ioBackend) {
+    NFD_LOG_INFO("changing I/O backend from " << m_ioBackend << " to " << ioBackend);
+    if (!m_channels.empty() || !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("I/O backend setting applies to new Ethernet channels and faces only");
+    }
+  }
+
   if (m_mcastConfig.isEnabled != mcastConfig.isEnabled) {
     if (mcastConfig.isEnabled) {
       NFD_LOG_INFO("enabling multicast on " << mcastConfig.group);
@@ -161,6 +188,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   // netifs may have changed.
   m_unicastConfig = unicastConfig;
   m_mcastConfig = mcastConfig;
+  m_ioBackend = ioBackend;
   this->applyConfig(context);
 }
 
@@ -217,13 +245,14 @@ EthernetFactory::doCreateFace(const CreateFaceRequest& req,
 
 shared_ptr<EthernetChannel>
 EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                               time::nanoseconds idleTimeout)
+                               time::nanoseconds idleTimeout,
+                               EthernetIoBackend ioBackend)
 {
   auto it = m_channels.find(localEndpoint->getName());
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout, ioBackend);
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -251,7 +280,8 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   opts.allowReassembly = true;
 
   auto linkService = make_unique<GenericLinkService>(opts);
-  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
+  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType,
+                                                           m_ioBackend);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[key] = face;
@@ -285,7 +315,7 @@ EthernetFactory::applyUnicastConfigToNetif(const shared_ptr<const ndn::net::Netw
     return nullptr;
   }
 
-  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout);
+  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout, m_ioBackend);
   if (m_unicastConfig.wantListen && !channel->isListening()) {
     try {
       channel->listen(this->addFace, nullptr);
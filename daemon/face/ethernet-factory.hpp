@@ -55,7 +55,8 @@ public:
    */
   shared_ptr<EthernetChannel>
   createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                time::nanoseconds idleTimeout);
+                time::nanoseconds idleTimeout,
+                EthernetIoBackend ioBackend = EthernetIoBackend::PCAP);
 
   /**
    * \brief Create a face to communicate on the given Ethernet multicast group
@@ -122,6 +123,9 @@ private:
   };
   MulticastConfig m_mcastConfig;
 
+  /// mechanism used by the transports of new unicast and multicast faces
+  EthernetIoBackend m_ioBackend = EthernetIoBackend::PCAP;
+
   /// (ifname, group) => face
   std::map<std::pair<std::string, ethernet::Address>, shared_ptr<Face>> m_mcastFaces;
 
@@ -0,0 +1,468 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethernet-packet-ring.hpp"
+
+#ifdef __linux__
+#include <pcap/pcap.h>
+#include <linux/filter.h>
+#include <linux/if_packet.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <boost/endian/conversion.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#if !defined(PCAP_NETMASK_UNKNOWN)
+#define PCAP_NETMASK_UNKNOWN  0xffffffff
+#endif
+#endif // __linux__
+
+namespace nfd {
+namespace face {
+
+#ifdef __linux__
+
+// The receive ring has the same total size as the libpcap buffer (see PcapHelper).
+// A block is handed to user space when it is full or when it has been open for
+// RX_BLOCK_TIMEOUT milliseconds, whichever comes first; the timeout bounds the
+// additional latency introduced by TPACKET_V3 under light load.
+const size_t RX_BLOCK_SIZE = 1 << 20;
+const size_t RX_BLOCK_COUNT = 4;
+const size_t RX_FRAME_SIZE = 1 << 11;
+const unsigned int RX_BLOCK_TIMEOUT = 1;
+
+// Each transmit frame must hold the largest NDN packet plus the Ethernet header and
+// the tpacket3_hdr/sockaddr_ll that precede the frame data.
+const size_t TX_FRAME_SIZE = 1 << 14;
+const size_t TX_FRAME_COUNT = 64;
+const size_t TX_BLOCK_SIZE = TX_FRAME_SIZE * 4;
+
+// frame data begins where sockaddr_ll would begin in a receive frame
+const size_t TX_DATA_OFFSET = TPACKET3_HDRLEN - sizeof(sockaddr_ll);
+
+static_assert(TX_DATA_OFFSET + ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE <= TX_FRAME_SIZE,
+              "TX_FRAME_SIZE is too small");
+
+EthernetPacketRing::EthernetPacketRing(const std::string& interfaceName, int interfaceIndex)
+  : m_interfaceName(interfaceName)
+  , m_interfaceIndex(interfaceIndex)
+  , m_fd(-1)
+  , m_nDropped(0)
+  , m_map(nullptr)
+  , m_mapSize(0)
+  , m_rxRing(nullptr)
+  , m_rxBlockSize(0)
+  , m_rxBlockCount(0)
+  , m_rxBlockIndex(0)
+  , m_isRxBlockInUse(false)
+  , m_rxFramesLeft(0)
+  , m_rxNextFrame(nullptr)
+  , m_txRing(nullptr)
+  , m_txFrameSize(0)
+  , m_txFrameCount(0)
+  , m_txFrameIndex(0)
+  , m_nTxQueued(0)
+  , m_nTxDropped(0)
+{
+  // protocol 0: no frames are received until the socket is bound in activate()
+  m_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+  if (m_fd < 0)
+    NDN_THROW(Error("socket: " + std::string(std::strerror(errno))));
+}
+
+EthernetPacketRing::~EthernetPacketRing()
+{
+  close();
+}
+
+void
+EthernetPacketRing::activate()
+{
+  int version = TPACKET_V3;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0)
+    NDN_THROW(Error("setsockopt(PACKET_VERSION): " + std::string(std::strerror(errno))));
+
+#ifdef PACKET_IGNORE_OUTGOING
+  // best effort, frames sent by this host are also skipped in readNextPacket()
+  int ignoreOutgoing = 1;
+  ::setsockopt(m_fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignoreOutgoing, sizeof(ignoreOutgoing));
+#endif
+
+  // let the kernel skip malformed transmit frames instead of stopping the ring
+  int discardMalformed = 1;
+  ::setsockopt(m_fd, SOL_PACKET, PACKET_LOSS, &discardMalformed, sizeof(discardMalformed));
+
+  tpacket_req3 rxReq{};
+  rxReq.tp_block_size = RX_BLOCK_SIZE;
+  rxReq.tp_block_nr = RX_BLOCK_COUNT;
+  rxReq.tp_frame_size = RX_FRAME_SIZE;
+  rxReq.tp_frame_nr = RX_BLOCK_COUNT * (RX_BLOCK_SIZE / RX_FRAME_SIZE);
+  rxReq.tp_retire_blk_tov = RX_BLOCK_TIMEOUT;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_RX_RING, &rxReq, sizeof(rxReq)) < 0)
+    NDN_THROW(Error("setsockopt(PACKET_RX_RING): " + std::string(std::strerror(errno))));
+  size_t rxSize = RX_BLOCK_SIZE * RX_BLOCK_COUNT;
+
+  // a TPACKET_V3 transmit ring requires Linux 4.11 or later; without it, frames are
+  // sent with one system call each
+  tpacket_req3 txReq{};
+  txReq.tp_block_size = TX_BLOCK_SIZE;
+  txReq.tp_block_nr = TX_FRAME_COUNT * TX_FRAME_SIZE / TX_BLOCK_SIZE;
+  txReq.tp_frame_size = TX_FRAME_SIZE;
+  txReq.tp_frame_nr = TX_FRAME_COUNT;
+  size_t txSize = 0;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_TX_RING, &txReq, sizeof(txReq)) == 0) {
+    txSize = TX_FRAME_SIZE * TX_FRAME_COUNT;
+  }
+
+  // the receive ring is mapped first, immediately followed by the transmit ring
+  void* map = ::mmap(nullptr, rxSize + txSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_LOCKED | MAP_POPULATE, m_fd, 0);
+  if (map == MAP_FAILED) {
+    // MAP_LOCKED fails when RLIMIT_MEMLOCK is too low, retry without it
+    map = ::mmap(nullptr, rxSize + txSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, 0);
+    if (map == MAP_FAILED)
+      NDN_THROW(Error("mmap: " + std::string(std::strerror(errno))));
+  }
+  m_map = static_cast<uint8_t*>(map);
+  m_mapSize = rxSize + txSize;
+
+  m_rxRing = m_map;
+  m_rxBlockSize = RX_BLOCK_SIZE;
+  m_rxBlockCount = RX_BLOCK_COUNT;
+  if (txSize > 0) {
+    m_txRing = m_map + rxSize;
+    m_txFrameSize = TX_FRAME_SIZE;
+    m_txFrameCount = TX_FRAME_COUNT;
+  }
+
+  // binding to the NDN ethertype lets the kernel discard all other frames early
+  sockaddr_ll sll{};
+  sll.sll_family = AF_PACKET;
+  sll.sll_protocol = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  sll.sll_ifindex = m_interfaceIndex;
+  if (::bind(m_fd, reinterpret_cast<sockaddr*>(&sll), sizeof(sll)) < 0)
+    NDN_THROW(Error("bind(" + m_interfaceName + "): " + std::string(std::strerror(errno))));
+}
+
+void
+EthernetPacketRing::close()
+{
+  if (m_map != nullptr) {
+    ::munmap(m_map, m_mapSize);
+    m_map = m_rxRing = m_txRing = nullptr;
+    m_mapSize = 0;
+    m_rxBlockCount = m_txFrameCount = 0;
+    m_isRxBlockInUse = false;
+    m_nTxQueued = 0;
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+}
+
+int
+EthernetPacketRing::getFd() const
+{
+  // see PcapHelper::getFd()
+  int fd = ::dup(m_fd);
+  if (fd < 0)
+    NDN_THROW(Error("dup: " + std::string(std::strerror(errno))));
+  return fd;
+}
+
+size_t
+EthernetPacketRing::getNDropped()
+{
+  tpacket_stats_v3 stats{};
+  socklen_t len = sizeof(stats);
+  if (::getsockopt(m_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &len) < 0)
+    NDN_THROW(Error("getsockopt(PACKET_STATISTICS): " + std::string(std::strerror(errno))));
+
+  // the kernel resets the statistics every time they are read
+  m_nDropped += stats.tp_drops;
+  return m_nDropped;
+}
+
+void
+EthernetPacketRing::setPacketFilter(const char* filter) const
+{
+  pcap_t* dead = pcap_open_dead(DLT_EN10MB, ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE);
+  if (dead == nullptr)
+    NDN_THROW(Error("pcap_open_dead failed"));
+
+  bpf_program prog;
+  if (pcap_compile(dead, &prog, filter, 1, PCAP_NETMASK_UNKNOWN) < 0) {
+    std::string err = pcap_geterr(dead);
+    pcap_close(dead);
+    NDN_THROW(Error("pcap_compile: " + err));
+  }
+  pcap_close(dead);
+
+  // struct bpf_insn and struct sock_filter have the same layout
+  static_assert(sizeof(bpf_insn) == sizeof(sock_filter), "Unexpected bpf_insn layout");
+  sock_fprog fprog{};
+  fprog.len = static_cast<unsigned short>(prog.bf_len);
+  fprog.filter = reinterpret_cast<sock_filter*>(prog.bf_insns);
+  int ret = ::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog));
+  int savedErrno = errno;
+  pcap_freecode(&prog);
+  if (ret < 0)
+    NDN_THROW(Error("setsockopt(SO_ATTACH_FILTER): " + std::string(std::strerror(savedErrno))));
+}
+
+std::tuple<const uint8_t*, size_t, std::string>
+EthernetPacketRing::readNextPacket()
+{
+  auto getBlock = [this] {
+    return reinterpret_cast<tpacket_block_desc*>(m_rxRing + m_rxBlockIndex * m_rxBlockSize);
+  };
+  auto releaseBlock = [this, &getBlock] {
+    __atomic_store_n(&getBlock()->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+    m_rxBlockIndex = (m_rxBlockIndex + 1) % m_rxBlockCount;
+    m_isRxBlockInUse = false;
+  };
+
+  if (m_rxBlockCount == 0) {
+    return std::make_tuple(nullptr, 0, "not activated");
+  }
+
+  // the frame returned by the previous call is no longer in use
+  if (m_isRxBlockInUse && m_rxFramesLeft == 0) {
+    releaseBlock();
+  }
+
+  while (true) {
+    if (!m_isRxBlockInUse) {
+      tpacket_block_desc* block = getBlock();
+      if ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0) {
+        return std::make_tuple(nullptr, 0, "");
+      }
+      m_isRxBlockInUse = true;
+      m_rxFramesLeft = block->hdr.bh1.num_pkts;
+      m_rxNextFrame = reinterpret_cast<uint8_t*>(block) + block->hdr.bh1.offset_to_first_pkt;
+      if (m_rxFramesLeft == 0) {
+        releaseBlock();
+        continue;
+      }
+    }
+
+    auto frame = reinterpret_cast<const tpacket3_hdr*>(m_rxNextFrame);
+    auto sll = reinterpret_cast<const sockaddr_ll*>(m_rxNextFrame + TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+    const uint8_t* pkt = m_rxNextFrame + frame->tp_mac;
+    size_t len = frame->tp_snaplen;
+    m_rxNextFrame += frame->tp_next_offset;
+    --m_rxFramesLeft;
+
+    // skip frames sent by this host, as PcapHelper does with PCAP_D_IN, and frames whose
+    // VLAN tag was removed by the kernel, which libpcap would have put back in the frame
+    if (sll->sll_pkttype == PACKET_OUTGOING || (frame->tp_status & TP_STATUS_VLAN_VALID) != 0) {
+      if (m_rxFramesLeft == 0) {
+        releaseBlock();
+      }
+      continue;
+    }
+
+    return std::make_tuple(pkt, len, "");
+  }
+}
+
+bool
+EthernetPacketRing::send(const ethernet::Address& dest, const ethernet::Address& src, const Block& payload)
+{
+  uint8_t header[ethernet::HDR_LEN];
+  std::copy(dest.begin(), dest.end(), header);
+  std::copy(src.begin(), src.end(), header + ethernet::ADDR_LEN);
+  uint16_t ethertype = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  std::memcpy(header + 2 * ethernet::ADDR_LEN, &ethertype, ethernet::TYPE_LEN);
+
+  if (m_txFrameCount == 0) {
+    return sendWithoutRing(header, payload);
+  }
+
+  auto frame = reinterpret_cast<tpacket3_hdr*>(m_txRing + m_txFrameIndex * m_txFrameSize);
+  auto isBusy = [frame] {
+    auto status = __atomic_load_n(&frame->tp_status, __ATOMIC_ACQUIRE);
+    return (status & (TP_STATUS_SEND_REQUEST | TP_STATUS_SENDING)) != 0;
+  };
+  if (isBusy()) {
+    // hand the queued frames to the kernel, which transmits them before returning
+    if (!flush())
+      return false;
+    if (isBusy()) {
+      if (m_nTxQueued > 0) {
+        // the kernel could not take the queued frames; sending this one without the ring
+        // would overtake them, so drop it as a full transmit queue would
+        ++m_nTxDropped;
+        return true;
+      }
+      // the kernel has taken all queued frames, but the device has not released them yet;
+      // frames sent without the ring are queued behind them, which preserves the order
+      return sendWithoutRing(header, payload);
+    }
+  }
+
+  size_t payloadLen = std::max(payload.size(), ethernet::MIN_DATA_LEN);
+  if (TX_DATA_OFFSET + ethernet::HDR_LEN + payloadLen > m_txFrameSize) {
+    m_lastError = "frame too large: " + to_string(ethernet::HDR_LEN + payloadLen);
+    return false;
+  }
+
+  uint8_t* data = reinterpret_cast<uint8_t*>(frame) + TX_DATA_OFFSET;
+  std::memcpy(data, header, ethernet::HDR_LEN);
+  std::copy(payload.begin(), payload.end(), data + ethernet::HDR_LEN);
+  // pad with zeroes if the payload is too short
+  std::fill(data + ethernet::HDR_LEN + payload.size(), data + ethernet::HDR_LEN + payloadLen, 0);
+
+  frame->tp_len = ethernet::HDR_LEN + payloadLen;
+  frame->tp_next_offset = 0;
+  __atomic_store_n(&frame->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+  m_txFrameIndex = (m_txFrameIndex + 1) % m_txFrameCount;
+  ++m_nTxQueued;
+  return true;
+}
+
+bool
+EthernetPacketRing::flush()
+{
+  if (m_nTxQueued == 0)
+    return true;
+
+  if (::send(m_fd, nullptr, 0, MSG_DONTWAIT) < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      // the frames stay in the ring and are transmitted by the next flush
+      return true;
+    }
+    setLastErrorFromErrno("send");
+    m_nTxQueued = 0;
+    return false;
+  }
+
+  m_nTxQueued = 0;
+  return true;
+}
+
+bool
+EthernetPacketRing::sendWithoutRing(const uint8_t* header, const Block& payload)
+{
+  static const uint8_t padding[ethernet::MIN_DATA_LEN] = {};
+
+  iovec iov[3];
+  iov[0].iov_base = const_cast<uint8_t*>(header);
+  iov[0].iov_len = ethernet::HDR_LEN;
+  iov[1].iov_base = const_cast<uint8_t*>(payload.wire());
+  iov[1].iov_len = payload.size();
+  iov[2].iov_base = const_cast<uint8_t*>(padding);
+  iov[2].iov_len = payload.size() < ethernet::MIN_DATA_LEN ? ethernet::MIN_DATA_LEN - payload.size() : 0;
+
+  msghdr msg{};
+  msg.msg_iov = iov;
+  msg.msg_iovlen = iov[2].iov_len > 0 ? 3 : 2;
+
+  // the destination is the interface the socket is bound to; never block the forwarding
+  // thread on a full socket send buffer or device queue
+  ssize_t sent = ::sendmsg(m_fd, &msg, MSG_DONTWAIT);
+  if (sent < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      // drop the frame, as a full transmit ring would
+      ++m_nTxDropped;
+      return true;
+    }
+    setLastErrorFromErrno("sendmsg");
+    return false;
+  }
+  return true;
+}
+
+void
+EthernetPacketRing::setLastErrorFromErrno(const char* operation)
+{
+  m_lastError = std::string(operation) + ": " + std::strerror(errno);
+}
+
+#else // __linux__
+
+EthernetPacketRing::EthernetPacketRing(const std::string&, int)
+{
+  NDN_THROW(Error("PACKET_MMAP is only supported on Linux"));
+}
+
+EthernetPacketRing::~EthernetPacketRing() = default;
+
+void
+EthernetPacketRing::activate()
+{
+}
+
+void
+EthernetPacketRing::close()
+{
+}
+
+int
+EthernetPacketRing::getFd() const
+{
+  return -1;
+}
+
+size_t
+EthernetPacketRing::getNDropped()
+{
+  return 0;
+}
+
+void
+EthernetPacketRing::setPacketFilter(const char*) const
+{
+}
+
+std::tuple<const uint8_t*, size_t, std::string>
+EthernetPacketRing::readNextPacket()
+{
+  return std::make_tuple(nullptr, 0, "not supported");
+}
+
+bool
+EthernetPacketRing::send(const ethernet::Address&, const ethernet::Address&, const Block&)
+{
+  return false;
+}
+
+bool
+EthernetPacketRing::flush()
+{
+  return false;
+}
+
+#endif // __linux__
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+#define NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+
+#include "ethernet-protocol.hpp"
+
+namespace nfd {
+namespace face {
+
+/**
+ * @brief Exchanges Ethernet frames with the kernel through PACKET_MMAP rings (Linux only).
+ *
+ * An AF_PACKET socket bound to the NDN ethertype on one network interface has a TPACKET_V3
+ * receive ring and, if the kernel supports it, a transmit ring mapped into the process.
+ * Received frames are read in place from the ring, and outgoing frames are written directly
+ * into the ring and handed to the kernel in batches by flush(). If the kernel does not
+ * support a TPACKET_V3 transmit ring (before Linux 4.11), frames are sent with sendmsg(2).
+ *
+ * The interface mirrors PcapHelper, so that EthernetTransport can use either.
+ */
+class EthernetPacketRing : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Open an AF_PACKET socket for the specified network interface.
+   * @throw Error on any error, including on platforms other than Linux
+   */
+  EthernetPacketRing(const std::string& interfaceName, int interfaceIndex);
+
+  ~EthernetPacketRing();
+
+  /**
+   * @brief Set up and map the rings, and start receiving frames.
+   * @throw Error on any error
+   */
+  void
+  activate();
+
+  /**
+   * @brief Unmap the rings and close the socket.
+   */
+  void
+  close();
+
+  /**
+   * @brief Obtain a file descriptor that becomes readable when frames are available.
+   * @pre activate() has been called.
+   * @return A duplicate of the socket descriptor. It is the caller's responsibility to close it.
+   * @throw Error on any error
+   */
+  int
+  getFd() const;
+
+  /**
+   * @brief Get last error message.
+   */
+  const std::string&
+  getLastError() const
+  {
+    return m_lastError;
+  }
+
+  /**
+   * @brief Get the number of frames dropped by the kernel because the receive ring was full.
+   * @throw Error on any error
+   */
+  size_t
+  getNDropped();
+
+  /**
+   * @brief Install a BPF filter, written in pcap-filter(7) syntax, on the socket.
+   * @pre activate() has been called.
+   * @throw Error on any error
+   */
+  void
+  setPacketFilter(const char* filter) const;
+
+  /**
+   * @brief Read the next frame from the receive ring.
+   * @return If a frame is available, returns a tuple containing a pointer to the frame
+   *         (including the link-layer header) and the size of the frame; the third
+   *         element must be ignored. If the ring is empty, returns a tuple containing
+   *         nullptr, 0, and an empty string.
+   * @warning The returned pointer must not be freed by the caller, and is valid only
+   *          until the next call to this function.
+   */
+  std::tuple<const uint8_t*, size_t, std::string>
+  readNextPacket();
+
+  /**
+   * @brief Queue a frame carrying @p payload for transmission.
+   *
+   * The payload is padded to the minimum Ethernet frame size. The frame is transmitted by
+   * the next call to flush(), or immediately if there is no transmit ring. If the ring is full
+   * and the kernel cannot take the queued frames yet, the frame is dropped and counted by
+   * getNTxDropped(), so that it does not overtake the queued frames. Without a transmit ring,
+   * the frame is sent without blocking, and dropped and counted likewise if the socket send
+   * buffer is full.
+   *
+   * @retval false the frame could not be queued or sent, see getLastError()
+   */
+  bool
+  send(const ethernet::Address& dest, const ethernet::Address& src, const Block& payload);
+
+  /**
+   * @brief Hand all queued frames to the kernel.
+   * @retval false the kernel reported an error, see getLastError()
+   */
+  bool
+  flush();
+
+  /**
+   * @return number of frames queued by send() and not yet handed to the kernel
+   */
+  size_t
+  getNQueued() const
+  {
+    return m_nTxQueued;
+  }
+
+  /**
+   * @return number of frames dropped by send() because the transmit ring or the socket
+   *         send buffer was full
+   */
+  size_t
+  getNTxDropped() const
+  {
+    return m_nTxDropped;
+  }
+
+  /**
+   * @return number of frames the transmit ring can hold, zero if there is no transmit ring
+   * @pre activate() has been called.
+   */
+  size_t
+  getTxRingCapacity() const
+  {
+    return m_txFrameCount;
+  }
+
+private:
+  bool
+  sendWithoutRing(const uint8_t* header, const Block& payload);
+
+  void
+  setLastErrorFromErrno(const char* operation);
+
+private:
+  std::string m_interfaceName;
+  int m_interfaceIndex;
+  int m_fd;
+  std::string m_lastError;
+  size_t m_nDropped;
+
+  uint8_t* m_map;
+  size_t m_mapSize;
+
+  uint8_t* m_rxRing;
+  size_t m_rxBlockSize;
+  size_t m_rxBlockCount;
+  size_t m_rxBlockIndex;    ///< block currently being read
+  bool m_isRxBlockInUse;    ///< whether m_rxBlockIndex has been handed to user space
+  size_t m_rxFramesLeft;    ///< frames not yet read in m_rxBlockIndex
+  uint8_t* m_rxNextFrame;
+
+  uint8_t* m_txRing;
+  size_t m_txFrameSize;
+  size_t m_txFrameCount;    ///< zero if there is no transmit ring
+  size_t m_txFrameIndex;    ///< next frame to be filled
+  size_t m_nTxQueued;
+  size_t m_nTxDropped;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
@@ -38,25 +38,52 @@ namespace face {
 
 NFD_LOG_INIT(EthernetTransport);
 
+/// maximum number of frames taken from the receive ring before yielding to other handlers
+const size_t MAX_RING_FRAMES_PER_READ = 256;
+
+std::ostream&
+operator<<(std::ostream& os, EthernetIoBackend backend)
+{
+  switch (backend) {
+    case EthernetIoBackend::PCAP:
+      return os << "pcap";
+    case EthernetIoBackend::PACKET_MMAP:
+      return os << "packet_mmap";
+  }
+  return os << static_cast<int>(backend);
+}
+
 EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                                     const ethernet::Address& remoteEndpoint)
+                                     const ethernet::Address& remoteEndpoint,
+                                     EthernetIoBackend backend)
   : m_socket(getGlobalIoService())
   , m_pcap(localEndpoint.getName())
   , m_srcAddress(localEndpoint.getEthernetAddress())
   , m_destAddress(remoteEndpoint)
   , m_interfaceName(localEndpoint.getName())
   , m_hasRecentlyReceived(false)
+  , m_isRingFlushScheduled(false)
 #ifdef _DEBUG
   , m_nDropped(0)
 #endif
 {
   try {
-    m_pcap.activate(DLT_EN10MB);
-    m_socket.assign(m_pcap.getFd());
+    if (backend == EthernetIoBackend::PACKET_MMAP) {
+      m_packetRing = make_unique<EthernetPacketRing>(m_interfaceName, localEndpoint.getIndex());
+      m_packetRing->activate();
+      m_socket.assign(m_packetRing->getFd());
+    }
+    else {
+      m_pcap.activate(DLT_EN10MB);
+      m_socket.assign(m_pcap.getFd());
+    }
   }
   catch (const PcapHelper::Error& e) {
     NDN_THROW_NESTED(Error(e.what()));
   }
+  catch (const EthernetPacketRing::Error& e) {
+    NDN_THROW_NESTED(Error(e.what()));
+  }
 
   // Set initial transport state based upon the state of the underlying NetworkInterface
   handleNetifStateChange(localEndpoint.getState());
@@ -74,11 +101,25 @@ EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndp
   asyncRead();
 }
 
+void
+EthernetTransport::reportExtendedCounters(const CounterReporter& report) const
+{
+  if (m_packetRing) {
+    report("packetRing/nOutDrops", m_packetRing->getNTxDropped());
+    report("packetRing/nOutQueued", m_packetRing->getNQueued());
+  }
+}
+
 void
 EthernetTransport::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (m_packetRing) {
+    // hand queued frames to the kernel before the ring goes away
+    m_packetRing->flush();
+  }
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
     // Use the non-throwing variants and ignore errors, if any.
@@ -87,6 +128,9 @@ EthernetTransport::doClose()
     m_socket.close(error);
   }
   m_pcap.close();
+  if (m_packetRing) {
+    m_packetRing->close();
+  }
 
   // Ensure that the Transport stays alive at least
   // until all pending handlers are dispatched
@@ -95,6 +139,15 @@ EthernetTransport::doClose()
   });
 }
 
+void
+EthernetTransport::setPacketFilter(const char* filter)
+{
+  if (m_packetRing)
+    m_packetRing->setPacketFilter(filter);
+  else
+    m_pcap.setPacketFilter(filter);
+}
+
 void
 EthernetTransport::handleNetifStateChange(ndn::net::InterfaceState netifState)
 {
@@ -120,6 +173,27 @@ EthernetTransport::doSend(const Block& packet)
 void
 EthernetTransport::sendPacket(const ndn::Block& block)
 {
+  if (m_packetRing) {
+    // the frame is built directly in the transmit ring
+    size_t nDropped = m_packetRing->getNTxDropped();
+    if (!m_packetRing->send(m_destAddress, m_srcAddress, block))
+      return handleError("Send operation failed: " + m_packetRing->getLastError());
+
+    if (m_packetRing->getNTxDropped() != nDropped)
+      NFD_LOG_FACE_DEBUG("Transmit ring full, dropped: " << block.size() << " bytes");
+    else
+      NFD_LOG_FACE_TRACE("Queued: " << block.size() << " bytes");
+    if (!m_isRingFlushScheduled) {
+      // transmit whatever has been queued once the current io_service turn is over
+      m_isRingFlushScheduled = true;
+      getGlobalIoService().post([this] {
+        m_isRingFlushScheduled = false;
+        this->flushPacketRing();
+      });
+    }
+    return;
+  }
+
   ndn::EncodingBuffer buffer(block);
 
   // pad with zeroes if the payload is too short
@@ -146,6 +220,16 @@ EthernetTransport::sendPacket(const ndn::Block& block)
     NFD_LOG_FACE_TRACE("Successfully sent: " << block.size() << " bytes");
 }
 
+void
+EthernetTransport::flushPacketRing()
+{
+  size_t nQueued = m_packetRing->getNQueued();
+  if (!m_packetRing->flush())
+    return handleError("Send operation failed: " + m_packetRing->getLastError());
+
+  NFD_LOG_FACE_TRACE("Flushed " << nQueued << " frame(s)");
+}
+
 void
 EthernetTransport::asyncRead()
 {
@@ -171,36 +255,87 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
   const uint8_t* pkt;
   size_t len;
   std::string err;
+
+  if (m_packetRing) {
+    // the readiness notification is edge-triggered, so take everything the ring holds
+    // let the forwarder process the frames of one readiness event as a batch
+    size_t nFrames = 0;
+    this->beginReceiveBurst();
+    for (; nFrames < MAX_RING_FRAMES_PER_READ && m_socket.is_open(); ++nFrames) {
+      std::tie(pkt, len, err) = m_packetRing->readNextPacket();
+      if (pkt == nullptr) {
+        if (!err.empty())
+          NFD_LOG_FACE_WARN("Read error: " << err);
+        break;
+      }
+      handleFrame(pkt, len);
+    }
+    this->endReceiveBurst();
+
+    if (!m_socket.is_open()) {
+      // the transport was closed while processing a frame, the ring is no longer mapped
+      return;
+    }
+
+#ifdef _DEBUG
+    reportDroppedFrames(m_packetRing->getNDropped());
+#endif
+
+    if (nFrames == MAX_RING_FRAMES_PER_READ) {
+      // more frames may be waiting, come back after other handlers had a chance to run
+      getGlobalIoService().post([this] {
+        if (m_socket.is_open())
+          this->handleRead({});
+      });
+      return;
+    }
+
+    asyncRead();
+    return;
+  }
+
   std::tie(pkt, len, err) = m_pcap.readNextPacket();
 
   if (pkt == nullptr) {
     NFD_LOG_FACE_WARN("Read error: " << err);
   }
   else {
-    const ether_header* eh;
-    std::tie(eh, err) = ethernet::checkFrameHeader(pkt, len, m_srcAddress,
-                                                   m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
-    if (eh == nullptr) {
-      NFD_LOG_FACE_WARN(err);
-    }
-    else {
-      ethernet::Address sender(eh->ether_shost);
-      pkt += ethernet::HDR_LEN;
-      len -= ethernet::HDR_LEN;
-      receivePayload(pkt, len, sender);
-    }
+    handleFrame(pkt, len);
   }
 
 #ifdef _DEBUG
-  size_t nDropped = m_pcap.getNDropped();
-  if (nDropped - m_nDropped > 0)
-    NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
-  m_nDropped = nDropped;
+  reportDroppedFrames(m_pcap.getNDropped());
 #endif
 
   asyncRead();
 }
 
+void
+EthernetTransport::handleFrame(const uint8_t* frame, size_t length)
+{
+  const ether_header* eh;
+  std::string err;
+  std::tie(eh, err) = ethernet::checkFrameHeader(frame, length, m_srcAddress,
+                                                 m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
+  if (eh == nullptr) {
+    NFD_LOG_FACE_WARN(err);
+    return;
+  }
+
+  ethernet::Address sender(eh->ether_shost);
+  receivePayload(frame + ethernet::HDR_LEN, length - ethernet::HDR_LEN, sender);
+}
+
+#ifdef _DEBUG
+void
+EthernetTransport::reportDroppedFrames(size_t nDropped)
+{
+  if (nDropped - m_nDropped > 0)
+    NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
+  m_nDropped = nDropped;
+}
+#endif
+
 void
 EthernetTransport::receivePayload(const uint8_t* payload, size_t length,
                                   const ethernet::Address& sender)
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 #define NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 
+#include "ethernet-packet-ring.hpp"
 #include "ethernet-protocol.hpp"
 #include "pcap-helper.hpp"
 #include "transport.hpp"
@@ -35,6 +36,17 @@
 namespace nfd {
 namespace face {
 
+/**
+ * @brief Mechanism used by an EthernetTransport to exchange frames with the kernel
+ */
+enum class EthernetIoBackend {
+  PCAP,        ///< libpcap, one system call per frame sent or received
+  PACKET_MMAP, ///< TPACKET_V3 rings shared with the kernel, see EthernetPacketRing (Linux only)
+};
+
+std::ostream&
+operator<<(std::ostream& os, EthernetIoBackend backend);
+
 /**
  * @brief Base class for Ethernet-based Transports
  */
@@ -57,13 +69,29 @@ public:
   receivePayload(const uint8_t* payload, size_t length,
                  const ethernet::Address& sender);
 
+  /** \brief reports the transmit counters of the PACKET_MMAP backend
+   *
+   *  "packetRing/nOutDrops" is the number of frames dropped because the transmit ring or the
+   *  socket send buffer was full, and "packetRing/nOutQueued" is the number of frames waiting
+   *  in the transmit ring. Nothing is reported with the PCAP backend.
+   */
+  void
+  reportExtendedCounters(const CounterReporter& report) const override;
+
 protected:
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                    const ethernet::Address& remoteEndpoint);
+                    const ethernet::Address& remoteEndpoint,
+                    EthernetIoBackend backend = EthernetIoBackend::PCAP);
 
   void
   doClose() final;
 
+  /**
+   * @brief Installs a packet filter, written in pcap-filter(7) syntax, on the active backend
+   */
+  void
+  setPacketFilter(const char* filter);
+
   bool
   hasRecentlyReceived() const
   {
@@ -89,18 +117,37 @@ private:
   void
   sendPacket(const ndn::Block& block);
 
+  /**
+   * @brief Hands the frames queued in the transmit ring to the kernel
+   */
+  void
+  flushPacketRing();
+
   void
   asyncRead();
 
   void
   handleRead(const boost::system::error_code& error);
 
+  /**
+   * @brief Validates the header of a received frame and processes its payload
+   */
+  void
+  handleFrame(const uint8_t* frame, size_t length);
+
+#ifdef _DEBUG
+  void
+  reportDroppedFrames(size_t nDropped);
+#endif
+
   void
   handleError(const std::string& errorMessage);
 
 protected:
   boost::asio::posix::stream_descriptor m_socket;
   PcapHelper m_pcap;
+  /// used instead of m_pcap if the backend is EthernetIoBackend::PACKET_MMAP
+  unique_ptr<EthernetPacketRing> m_packetRing;
   ethernet::Address m_srcAddress;
   ethernet::Address m_destAddress;
   std::string m_interfaceName;
@@ -109,8 +156,9 @@ private:
   signal::ScopedConnection m_netifStateChangedConn;
   signal::ScopedConnection m_netifMtuChangedConn;
   bool m_hasRecentlyReceived;
+  bool m_isRingFlushScheduled;
 #ifdef _DEBUG
-  /// number of frames dropped by the kernel, as reported by libpcap
+  /// number of frames dropped by the kernel, as reported by the backend
   size_t m_nDropped;
 #endif
 };
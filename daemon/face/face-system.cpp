@@ -24,6 +24,7 @@
  */
 
 #include "face-system.hpp"
+#include "io-thread.hpp"
 #include "protocol-factory.hpp"
 #include "netdev-bound.hpp"
 #include "common/global.hpp"
@@ -39,6 +40,8 @@ const std::string CFGSEC_GENERAL = "general";
 const std::string CFGSEC_GENERAL_FQ = CFGSEC_FACESYSTEM + ".general";
 const std::string CFGSEC_NETDEVBOUND = "netdev_bound";
 
+const size_t FaceSystem::MAX_IO_THREADS = 64;
+
 FaceSystem::FaceSystem(FaceTable& faceTable, shared_ptr<ndn::net::NetworkMonitor> netmon)
   : m_faceTable(faceTable)
   , m_netmon(std::move(netmon))
@@ -111,12 +114,32 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
       if (key == "enable_congestion_marking") {
         context.generalConfig.wantCongestionMarking = ConfigFile::parseYesNo(pair, CFGSEC_GENERAL_FQ);
       }
+      else if (key == "io_threads") {
+        context.generalConfig.nIoThreads = ConfigFile::parseNumber<size_t>(pair, CFGSEC_GENERAL_FQ);
+        if (context.generalConfig.nIoThreads > MAX_IO_THREADS) {
+          NDN_THROW(ConfigFile::Error(CFGSEC_GENERAL_FQ + ".io_threads must be between 0 and " +
+                                      to_string(MAX_IO_THREADS)));
+        }
+      }
       else {
         NDN_THROW(ConfigFile::Error("Unrecognized option " + CFGSEC_GENERAL_FQ + "." + key));
       }
     }
   }
 
+  if (!isDryRun) {
+    size_t nIoThreads = context.generalConfig.nIoThreads;
+    if (m_ioThreadPool == nullptr && nIoThreads > 0) {
+      NFD_LOG_INFO("Starting " << nIoThreads << " I/O thread(s)");
+      m_ioThreadPool = make_unique<IoThreadPool>(nIoThreads);
+    }
+    else if (m_ioThreadPool != nullptr && m_ioThreadPool->size() != nIoThreads) {
+      // existing faces keep using their threads, so the pool is not resized on reload
+      NFD_LOG_WARN("Cannot change " << CFGSEC_GENERAL_FQ << ".io_threads without restarting");
+    }
+    context.ioThreadPool = m_ioThreadPool.get();
+  }
+
   // process in protocol factories
   for (const auto& pair : m_factories) {
     const std::string& sectionName = pair.first;
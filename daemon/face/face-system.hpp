@@ -39,6 +39,7 @@ class FaceTable;
 
 namespace face {
 
+class IoThreadPool;
 class NetdevBound;
 class ProtocolFactory;
 struct ProtocolFactoryCtorParams;
@@ -84,11 +85,16 @@ public:
   void
   setConfigFile(ConfigFile& configFile);
 
+  /** \brief upper bound of face_system.general.io_threads
+   */
+  static const size_t MAX_IO_THREADS;
+
   /** \brief configuration options from "general" section
    */
   struct GeneralConfig
   {
     bool wantCongestionMarking = true;
+    size_t nIoThreads = 0;
   };
 
   /** \brief context for processing a config section in ProtocolFactory
@@ -98,8 +104,20 @@ public:
   public:
     GeneralConfig generalConfig;
     bool isDryRun;
+    /** \brief threads that perform socket I/O for faces, or nullptr if faces perform
+     *         socket I/O on the forwarding thread; always nullptr during a dry run
+     */
+    IoThreadPool* ioThreadPool = nullptr;
   };
 
+  /** \return threads that perform socket I/O for faces, or nullptr if none have been started
+   */
+  IoThreadPool*
+  getIoThreadPool() const
+  {
+    return m_ioThreadPool.get();
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ProtocolFactoryCtorParams
   makePFCtorParams();
@@ -110,6 +128,13 @@ private:
                 const std::string& filename);
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief threads that perform socket I/O for faces
+   *
+   *  Declared before the factories, so that it outlives the channels that refer to it.
+   *  Transports share ownership of the individual threads they use.
+   */
+  unique_ptr<IoThreadPool> m_ioThreadPool;
+
   /** \brief config section name => protocol factory
    */
   std::map<std::string, unique_ptr<ProtocolFactory>> m_factories;
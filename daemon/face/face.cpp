@@ -34,6 +34,8 @@ Face::Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport)
   , afterReceiveNack(service->afterReceiveNack)
   , onDroppedInterest(service->onDroppedInterest)
   , afterStateChange(transport->afterStateChange)
+  , beforeReceiveBurst(transport->beforeReceiveBurst)
+  , afterReceiveBurst(transport->afterReceiveBurst)
   , m_id(INVALID_FACEID)
   , m_service(std::move(service))
   , m_transport(std::move(transport))
@@ -164,6 +164,16 @@ public: // properties
    */
   signal::Signal<Transport, FaceState/*old*/, FaceState/*new*/>& afterStateChange;
 
+  /** \brief signals before a burst of packets received by the transport in one read
+   *  \sa Transport::beforeReceiveBurst
+   */
+  signal::Signal<Transport>& beforeReceiveBurst;
+
+  /** \brief signals after a burst of packets received by the transport in one read
+   *  \sa Transport::afterReceiveBurst
+   */
+  signal::Signal<Transport>& afterReceiveBurst;
+
   /** \return expiration time of the face
    *  \retval time::steady_clock::TimePoint::max() the face has an indefinite lifetime
    */
@@ -44,6 +44,7 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   , m_fragmenter(m_options.fragmenterOptions, this)
   , m_reassembler(m_options.reassemblerOptions, this)
   , m_reliability(m_options.reliabilityOptions, this)
+  , m_egressScheduler(m_options.egressSchedulerOptions)
   , m_lastSeqNo(-2)
   , m_nextMarkTime(time::steady_clock::TimePoint::max())
   , m_nMarkedSinceInMarkingState(0)
@@ -51,6 +52,7 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   m_reassembler.beforeTimeout.connect([this] (auto...) { ++this->nReassemblyTimeouts; });
   m_reliability.onDroppedInterest.connect([this] (const auto& i) { this->notifyDroppedInterest(i); });
   nReassembling.observe(&m_reassembler);
+  nEgressQueued.observe(&m_egressScheduler);
 }
 
 void
@@ -60,6 +62,11 @@ GenericLinkService::setOptions(const GenericLinkService::Options& options)
   m_fragmenter.setOptions(m_options.fragmenterOptions);
   m_reassembler.setOptions(m_options.reassemblerOptions);
   m_reliability.setOptions(m_options.reliabilityOptions);
+  m_egressScheduler.setOptions(m_options.egressSchedulerOptions);
+
+  if (!m_options.allowEgressScheduling) {
+    this->flushEgressQueues();
+  }
 }
 
 ssize_t
@@ -119,7 +126,12 @@ GenericLinkService::doSendInterest(const Interest& interest)
 
   encodeLpFields(interest, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), true);
+  if (m_options.allowEgressScheduling) {
+    this->scheduleNetPacket(std::move(lpPacket), true, tlv::Interest, interest.getName());
+  }
+  else {
+    this->sendNetPacket(std::move(lpPacket), true);
+  }
 }
 
 void
@@ -129,7 +141,12 @@ GenericLinkService::doSendData(const Data& data)
 
   encodeLpFields(data, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  if (m_options.allowEgressScheduling) {
+    this->scheduleNetPacket(std::move(lpPacket), false, tlv::Data, data.getName());
+  }
+  else {
+    this->sendNetPacket(std::move(lpPacket), false);
+  }
 }
 
 void
@@ -140,7 +157,12 @@ GenericLinkService::doSendNack(const lp::Nack& nack)
 
   encodeLpFields(nack, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  if (m_options.allowEgressScheduling) {
+    this->scheduleNetPacket(std::move(lpPacket), false, lp::tlv::Nack, nack.getInterest().getName());
+  }
+  else {
+    this->sendNetPacket(std::move(lpPacket), false);
+  }
 }
 
 void
@@ -242,14 +264,76 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
   }
 }
 
+void
+GenericLinkService::scheduleNetPacket(lp::Packet&& pkt, bool isInterest, uint32_t packetType,
+                                      const Name& name)
+{
+  size_t size = pkt.wireEncode().size();
+  m_egressScheduler.enqueue(m_egressScheduler.classify(packetType, name),
+                            {std::move(pkt), isInterest, size});
+
+  while (m_egressScheduler.isOverCapacity()) {
+    auto dropped = m_egressScheduler.dropFromLongestFlow();
+    ++this->nEgressDropped;
+    NFD_LOG_FACE_DEBUG("egress scheduler is full: DROP");
+
+    if (dropped.isInterest) {
+      ndn::Buffer::const_iterator fragBegin, fragEnd;
+      std::tie(fragBegin, fragEnd) = dropped.packet.get<lp::FragmentField>();
+      this->notifyDroppedInterest(Interest(Block(&*fragBegin, std::distance(fragBegin, fragEnd))));
+    }
+  }
+
+  if (!m_egressPollEvent) {
+    this->serveEgressQueues();
+  }
+}
+
+void
+GenericLinkService::serveEgressQueues()
+{
+  m_egressPollEvent.cancel();
+
+  size_t target = m_options.egressSchedulerOptions.transportQueueTarget;
+  while (!m_egressScheduler.empty()) {
+    ssize_t sendQueueLength = getTransport()->estimateSendQueueLength(target);
+    // the transport must support retrieving the send queue length; otherwise, holding packets
+    // would only delay them
+    if (sendQueueLength >= 0 && static_cast<size_t>(sendQueueLength) > target) {
+      m_egressPollEvent = getScheduler().schedule(SOCKET_SEND_QUEUE_SAMPLING_INTERVAL,
+                                                  [this] { this->serveEgressQueues(); });
+      return;
+    }
+
+    auto item = m_egressScheduler.dequeue();
+    this->sendNetPacket(std::move(item.packet), item.isInterest);
+  }
+}
+
+void
+GenericLinkService::flushEgressQueues()
+{
+  m_egressPollEvent.cancel();
+
+  while (!m_egressScheduler.empty()) {
+    auto item = m_egressScheduler.dequeue();
+    this->sendNetPacket(std::move(item.packet), item.isInterest);
+  }
+}
+
 void
 GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
 {
-  ssize_t sendQueueLength = getTransport()->getSendQueueLength();
+  // packets held in the egress scheduler count towards the threshold of the transport queue
+  size_t egressBytes = m_egressScheduler.getQueuedBytes();
+  size_t transportThreshold = egressBytes < m_options.defaultCongestionThreshold ?
+                              m_options.defaultCongestionThreshold - egressBytes : 0;
+  ssize_t sendQueueLength = getTransport()->estimateSendQueueLength(transportThreshold);
   // The transport must support retrieving the current send queue length
   if (sendQueueLength < 0) {
     return;
   }
+  sendQueueLength += egressBytes;
 
   if (sendQueueLength > 0) {
     NFD_LOG_FACE_TRACE("txqlen=" << sendQueueLength << " threshold=" <<
@@ -462,6 +546,10 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
     }
   }
 
+  if (firstPkt.has<lp::PitTokenField>()) {
+    data->setTag(make_shared<lp::PitToken>(firstPkt.get<lp::PitTokenField>()));
+  }
+
   this->receiveData(*data, endpointId);
 }
 
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_GENERIC_LINK_SERVICE_HPP
 
 #include "link-service.hpp"
+#include "egress-scheduler.hpp"
 #include "lp-fragmenter.hpp"
 #include "lp-reassembler.hpp"
 #include "lp-reliability.hpp"
@@ -88,6 +89,15 @@ public:
   /** \brief count of outgoing LpPackets that were marked with congestion marks
    */
   PacketCounter nCongestionMarked;
+
+  /** \brief count of outgoing network-layer packets waiting in the egress scheduler
+   */
+  SizeCounter<EgressScheduler> nEgressQueued;
+
+  /** \brief count of outgoing network-layer packets dropped because the egress scheduler
+   *         was full
+   */
+  PacketCounter nEgressDropped;
 };
 
 /** \brief GenericLinkService is a LinkService that implements the NDNLPv2 protocol
@@ -131,6 +141,18 @@ public:
      */
     LpReliability::Options reliabilityOptions;
 
+    /** \brief enables per-flow egress scheduling
+     *
+     *  Outgoing packets are held in per-flow queues while the transport send queue is above
+     *  the target, and released in deficit round robin order. The transport must support
+     *  retrieving the send queue length; otherwise, packets are sent immediately.
+     */
+    bool allowEgressScheduling = false;
+
+    /** \brief options for egress scheduling
+     */
+    EgressScheduler::Options egressSchedulerOptions;
+
     /** \brief enables send queue congestion detection and marking
      */
     bool allowCongestionMarking = false;
@@ -236,6 +258,28 @@ private: // send path
   void
   sendNetPacket(lp::Packet&& pkt, bool isInterest);
 
+  /** \brief send a complete network layer packet, or hold it in the egress scheduler
+   *  \param pkt LpPacket containing a complete network layer packet
+   *  \param isInterest whether the network layer packet is an Interest
+   *  \param packetType TLV-TYPE of the network layer packet, or lp::tlv::Nack
+   *  \param name name of the network layer packet
+   */
+  void
+  scheduleNetPacket(lp::Packet&& pkt, bool isInterest, uint32_t packetType, const Name& name);
+
+  /** \brief send packets from the egress scheduler while the transport send queue is below
+   *         the target
+   *
+   *  If packets remain in the scheduler, this is invoked again after a polling interval.
+   */
+  void
+  serveEgressQueues();
+
+  /** \brief send all packets in the egress scheduler, regardless of the send queue length
+   */
+  void
+  flushEgressQueues();
+
   /** \brief if the send queue is found to be congested, add a congestion mark to the packet
    *         according to CoDel
    *  \sa https://tools.ietf.org/html/rfc8289
@@ -302,6 +346,7 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   LpFragmenter m_fragmenter;
   LpReassembler m_reassembler;
   LpReliability m_reliability;
+  EgressScheduler m_egressScheduler;
   lp::Sequence m_lastSeqNo;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -310,6 +355,10 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /// number of marked packets in the current incident of congestion
   size_t m_nMarkedSinceInMarkingState;
 
+private:
+  /// polls the transport send queue while packets are held in the egress scheduler
+  scheduler::ScopedEventId m_egressPollEvent;
+
   friend class LpReliability;
 };
 
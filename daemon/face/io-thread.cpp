@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "io-thread.hpp"
+#include "common/logger.hpp"
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT(IoThread);
+
+IoThread::IoThread(size_t index)
+  : m_index(index)
+  , m_work(make_unique<boost::asio::io_service::work>(m_ioService))
+  , m_thread([this] { run(); })
+{
+  NFD_LOG_DEBUG("Started I/O thread " << m_index);
+}
+
+IoThread::~IoThread()
+{
+  BOOST_ASSERT(!isCurrentThread());
+
+  // io_service::run() returns after the sockets attached to it have been closed
+  // and the resulting handlers have been invoked
+  m_work.reset();
+  m_thread.join();
+  NFD_LOG_DEBUG("Stopped I/O thread " << m_index);
+}
+
+void
+IoThread::run()
+{
+  while (true) {
+    try {
+      m_ioService.run();
+      return;
+    }
+    catch (const std::exception& e) {
+      // an exception from one transport's handler must not stop I/O of other transports
+      NFD_LOG_ERROR("Exception on I/O thread " << m_index << ": " << e.what());
+    }
+  }
+}
+
+IoThreadPool::IoThreadPool(size_t nThreads)
+{
+  BOOST_ASSERT(nThreads > 0);
+
+  m_threads.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_threads.push_back(make_shared<IoThread>(i));
+  }
+}
+
+shared_ptr<IoThread>
+IoThreadPool::next()
+{
+  auto thread = m_threads[m_next];
+  m_next = (m_next + 1) % m_threads.size();
+  return thread;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_IO_THREAD_HPP
+#define NFD_DAEMON_FACE_IO_THREAD_HPP
+
+#include "core/common.hpp"
+
+#include <thread>
+
+namespace nfd {
+namespace face {
+
+/** \brief A dedicated thread that performs socket I/O on behalf of transports
+ *
+ *  The thread runs its own io_service until the IoThread is destroyed. Transports that
+ *  offload their socket operations to an IoThread share ownership of it, so that the thread
+ *  outlives all sockets attached to its io_service.
+ *
+ *  \warning Handlers posted to the IoThread must not touch Face, LinkService, or Transport
+ *           state, which is owned by the forwarding thread. They communicate with the
+ *           forwarding thread through SpscRing and getGlobalIoService().post().
+ */
+class IoThread : noncopyable
+{
+public:
+  explicit
+  IoThread(size_t index = 0);
+
+  /** \brief stop accepting new work, wait for pending handlers, and join the thread
+   */
+  ~IoThread();
+
+  boost::asio::io_service&
+  getIoService()
+  {
+    return m_ioService;
+  }
+
+  size_t
+  getIndex() const
+  {
+    return m_index;
+  }
+
+  /** \return whether the calling thread is this IoThread
+   */
+  bool
+  isCurrentThread() const
+  {
+    return std::this_thread::get_id() == m_thread.get_id();
+  }
+
+private:
+  void
+  run();
+
+private:
+  const size_t m_index;
+  boost::asio::io_service m_ioService;
+  unique_ptr<boost::asio::io_service::work> m_work;
+  std::thread m_thread;
+};
+
+/** \brief A set of IoThreads among which transports are distributed
+ */
+class IoThreadPool : noncopyable
+{
+public:
+  /** \brief start \p nThreads threads
+   *  \pre nThreads > 0
+   */
+  explicit
+  IoThreadPool(size_t nThreads);
+
+  size_t
+  size() const
+  {
+    return m_threads.size();
+  }
+
+  /** \brief select a thread for a new transport, in round-robin order
+   */
+  shared_ptr<IoThread>
+  next();
+
+private:
+  std::vector<shared_ptr<IoThread>> m_threads;
+  size_t m_next = 0;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_IO_THREAD_HPP
@@ -42,7 +42,8 @@ public:
    */
   MulticastEthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
                              const ethernet::Address& mcastAddress,
-                             ndn::nfd::LinkType linkType);
+                             ndn::nfd::LinkType linkType,
+                             EthernetIoBackend backend = EthernetIoBackend::PCAP);
 
 private:
   /**
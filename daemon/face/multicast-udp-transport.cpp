@@ -45,8 +45,10 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED((DatagramTransport<boost::asio::ip::udp, Multica
 MulticastUdpTransport::MulticastUdpTransport(const protocol::endpoint& multicastGroup,
                                              protocol::socket&& recvSocket,
                                              protocol::socket&& sendSocket,
-                                             ndn::nfd::LinkType linkType)
-  : DatagramTransport(std::move(recvSocket))
+                                             ndn::nfd::LinkType linkType,
+                                             size_t receiveBatchSize,
+                                             size_t sendBatchSize)
+  : DatagramTransport(std::move(recvSocket), receiveBatchSize, sendBatchSize)
   , m_multicastGroup(multicastGroup)
   , m_sendSocket(std::move(sendSocket))
 {
@@ -67,6 +69,7 @@ MulticastUdpTransport::MulticastUdpTransport(const protocol::endpoint& multicast
   else {
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
+  this->setSendBatchTarget(m_sendSocket, m_multicastGroup);
 
   NFD_LOG_FACE_DEBUG("Creating transport");
 }
@@ -78,6 +81,9 @@ MulticastUdpTransport::getSendQueueLength()
   if (queueLength == QUEUE_ERROR) {
     NFD_LOG_FACE_WARN("Failed to obtain send queue length from socket: " << std::strerror(errno));
   }
+  else if (queueLength >= 0) {
+    queueLength += getSendBatchBytes();
+  }
   return queueLength;
 }
 
@@ -86,6 +92,11 @@ MulticastUdpTransport::doSend(const Block& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (getSendBatchSize() > 1) {
+    enqueueSend(packet);
+    return;
+  }
+
   m_sendSocket.async_send_to(boost::asio::buffer(packet), m_multicastGroup,
                              // 'packet' is copied into the lambda to retain the underlying Buffer
                              [this, packet] (auto&&... args) {
@@ -96,6 +107,8 @@ MulticastUdpTransport::doSend(const Block& packet)
 void
 MulticastUdpTransport::doClose()
 {
+  flushSendBatch();
+
   if (m_sendSocket.is_open()) {
     NFD_LOG_FACE_TRACE("Closing sending socket");
 
@@ -61,11 +61,15 @@ public:
    * \param recvSocket socket used to receive multicast packets
    * \param sendSocket socket used to send to the multicast group
    * \param linkType either `ndn::nfd::LINK_TYPE_MULTI_ACCESS` or `ndn::nfd::LINK_TYPE_AD_HOC`
+   * \param receiveBatchSize maximum number of datagrams read from \p recvSocket per readiness event
+   * \param sendBatchSize maximum number of packets coalesced into one send on \p sendSocket
    */
   MulticastUdpTransport(const protocol::endpoint& multicastGroup,
                         protocol::socket&& recvSocket,
                         protocol::socket&& sendSocket,
-                        ndn::nfd::LinkType linkType);
+                        ndn::nfd::LinkType linkType,
+                        size_t receiveBatchSize = 1,
+                        size_t sendBatchSize = 1);
 
   ssize_t
   getSendQueueLength() final;
@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "receive-buffer-pool.hpp"
+
+namespace nfd {
+namespace face {
+
+ReceiveBufferPool::ReceiveBufferPool(size_t bufferSize, size_t maxIdleBuffers)
+  : m_bufferSize(bufferSize)
+  , m_freeList(make_shared<FreeList>())
+{
+  m_freeList->maxBuffers = maxIdleBuffers;
+}
+
+shared_ptr<ndn::Buffer>
+ReceiveBufferPool::acquire()
+{
+  unique_ptr<ndn::Buffer> buffer;
+  {
+    std::lock_guard<std::mutex> lock(m_freeList->mutex);
+    if (!m_freeList->buffers.empty()) {
+      buffer = std::move(m_freeList->buffers.back());
+      m_freeList->buffers.pop_back();
+    }
+    else {
+      ++m_freeList->nAllocations;
+    }
+  }
+
+  if (buffer == nullptr) {
+    buffer = make_unique<ndn::Buffer>(m_bufferSize);
+  }
+
+  weak_ptr<FreeList> freeList = m_freeList;
+  return shared_ptr<ndn::Buffer>(buffer.release(),
+                                 [freeList] (ndn::Buffer* b) { release(freeList, b); });
+}
+
+void
+ReceiveBufferPool::release(const weak_ptr<FreeList>& freeList, ndn::Buffer* buffer)
+{
+  unique_ptr<ndn::Buffer> owned(buffer);
+
+  auto fl = freeList.lock();
+  if (fl == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(fl->mutex);
+  if (fl->buffers.size() < fl->maxBuffers) {
+    fl->buffers.push_back(std::move(owned));
+  }
+}
+
+size_t
+ReceiveBufferPool::getNIdleBuffers() const
+{
+  std::lock_guard<std::mutex> lock(m_freeList->mutex);
+  return m_freeList->buffers.size();
+}
+
+uint64_t
+ReceiveBufferPool::getNAllocations() const
+{
+  std::lock_guard<std::mutex> lock(m_freeList->mutex);
+  return m_freeList->nAllocations;
+}
+
+ReceiveBufferPool&
+getReceiveBufferPool()
+{
+  static thread_local ReceiveBufferPool pool;
+  return pool;
+}
+
+ReceiveBufferPool&
+getStreamReceiveBufferPool()
+{
+  // the buffers are larger, so fewer of them are kept idle
+  static thread_local ReceiveBufferPool pool(STREAM_RECEIVE_BUFFER_SIZE, 64);
+  return pool;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+#define NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+
+#include "core/common.hpp"
+
+#include <mutex>
+
+namespace nfd {
+namespace face {
+
+/** \brief A pool of fixed-size buffers into which transports receive packets.
+ *
+ *  A transport reads from its socket directly into a buffer acquired from the pool,
+ *  and decodes packets as Blocks that share ownership of that buffer, so that no copy
+ *  is made. The buffer returns to the pool when the last Block referring to it is released.
+ *  If the pool no longer exists at that time, the buffer is simply deallocated.
+ *
+ *  Buffers can be released on any thread.
+ */
+class ReceiveBufferPool : noncopyable
+{
+public:
+  explicit
+  ReceiveBufferPool(size_t bufferSize = ndn::MAX_NDN_PACKET_SIZE, size_t maxIdleBuffers = 256);
+
+  /** \brief get a buffer of getBufferSize() octets
+   *
+   *  The content of the buffer is unspecified.
+   */
+  shared_ptr<ndn::Buffer>
+  acquire();
+
+  size_t
+  getBufferSize() const
+  {
+    return m_bufferSize;
+  }
+
+  /** \return number of buffers kept in the pool for reuse
+   */
+  size_t
+  getNIdleBuffers() const;
+
+  /** \return number of buffers allocated because no idle buffer was available
+   */
+  uint64_t
+  getNAllocations() const;
+
+private:
+  struct FreeList
+  {
+    std::mutex mutex;
+    std::vector<unique_ptr<ndn::Buffer>> buffers;
+    size_t maxBuffers;
+    uint64_t nAllocations = 0;
+  };
+
+  static void
+  release(const weak_ptr<FreeList>& freeList, ndn::Buffer* buffer);
+
+private:
+  const size_t m_bufferSize;
+  shared_ptr<FreeList> m_freeList;
+};
+
+/** \brief get the receive buffer pool of the calling thread
+ */
+ReceiveBufferPool&
+getReceiveBufferPool();
+
+/** \brief size of the buffers in getStreamReceiveBufferPool()
+ */
+const size_t STREAM_RECEIVE_BUFFER_SIZE = 4 * ndn::MAX_NDN_PACKET_SIZE;
+
+/** \brief get the pool of stream receive buffers of the calling thread
+ *
+ *  These buffers can hold several packets of maximum size, so that a stream transport decodes
+ *  many packets in place before a partially received packet has to be moved.
+ */
+ReceiveBufferPool&
+getStreamReceiveBufferPool();
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
@@ -27,24 +27,63 @@
 #define NFD_DAEMON_FACE_STREAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "codel.hpp"
+#include "receive-buffer-pool.hpp"
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
-#include <queue>
+#include <deque>
 
 namespace nfd {
 namespace face {
 
+/** \brief Counters provided by StreamTransport.
+ *  \note The type name StreamTransportCounters is an implementation detail.
+ *        Use StreamTransport::Counters in public API.
+ */
+class StreamTransportCounters : public virtual Transport::Counters
+{
+public:
+  /** \brief number of received bytes copied within or between receive buffers
+   *
+   *  Complete packets are decoded in place. Bytes are copied only when a partially received
+   *  packet does not fit in the rest of the receive buffer.
+   */
+  ByteCounter nInBytesCopied;
+
+  /** \brief number of packets that have left the send queue to be written to the socket
+   */
+  PacketCounter nOutQueueDequeued;
+
+  /** \brief total time that the nOutQueueDequeued packets have spent in the send queue
+   */
+  DurationCounter outQueueSojournTime;
+
+  /** \brief number of packets dropped by CoDel at the head of the send queue
+   */
+  PacketCounter nOutCodelDropped;
+
+  /** \brief number of packets dropped because the send queue was at its size limit
+   */
+  PacketCounter nOutQueueOverflow;
+};
+
 /** \brief Implements Transport for stream-based protocols.
  *
  *  \tparam Protocol a stream-based protocol in Boost.Asio
  */
 template<class Protocol>
 class StreamTransport : public Transport
+                      , protected virtual StreamTransportCounters
 {
 public:
   typedef Protocol protocol;
 
+  /** \brief Counters provided by StreamTransport.
+   *  \sa StreamTransportCounters
+   */
+  using Counters = StreamTransportCounters;
+
   /** \brief Construct stream transport.
    *
    *  \param socket Protocol-specific socket for the created transport
@@ -52,9 +91,48 @@ public:
   explicit
   StreamTransport(typename protocol::socket&& socket);
 
+  const Counters&
+  getCounters() const final;
+
+  /** \brief reports StreamTransportCounters
+   *
+   *  outQueueSojournTime is reported in nanoseconds.
+   */
+  void
+  reportExtendedCounters(const CounterReporter& report) const override;
+
   ssize_t
   getSendQueueLength() override;
 
+  /** \brief enable CoDel active queue management on the send queue
+   *
+   *  Packets selected by CoDel are dropped.
+   *
+   *  \param isMarkedUpstream whether the link service signals congestion on the same queue
+   *                          with CongestionMarks; if true, CoDel is bypassed
+   */
+  void
+  enableCodel(const Codel::Options& options, bool isMarkedUpstream);
+
+  /** \return CoDel instance managing the send queue, or nullptr if CoDel is disabled
+   */
+  const Codel*
+  getCodel() const
+  {
+    return m_codel.get();
+  }
+
+  /** \brief set the maximum number of octets in the send queue
+   *
+   *  A packet that would exceed this limit is dropped, unless the send queue is empty.
+   *  Zero, the default, means no limit.
+   */
+  void
+  setSendQueueLimit(size_t nBytes)
+  {
+    m_sendQueueLimit = nBytes;
+  }
+
 protected:
   void
   doClose() override;
@@ -65,6 +143,8 @@ protected:
   void
   doSend(const Block& packet) override;
 
+  /** \brief write as many queued packets as allowed by MAX_SEND_BATCH_BYTES in one operation
+   */
   void
   sendFromQueue();
 
@@ -95,31 +175,109 @@ protected:
   getSendQueueBytes() const;
 
 protected:
+  /** \brief maximum number of bytes gathered into a single write operation
+   *
+   *  A packet larger than this limit is still written, alone.
+   */
+  static constexpr size_t MAX_SEND_BATCH_BYTES = 65536;
+
   typename protocol::socket m_socket;
 
   NFD_LOG_MEMBER_DECL();
 
 private:
-  uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
+  /** \brief decode the TLV element starting at \p offset in m_receiveBuffer
+   *  \return whether a complete element was found, the element (sharing m_receiveBuffer),
+   *          and the size of the element including its TLV header, or 0 if the header
+   *          has not been fully received
+   */
+  std::tuple<bool, Block, size_t>
+  decodeElement(size_t offset) const;
+
+  /** \brief ensure that the element starting at m_receiveBufferOffset can be completed
+   *         in m_receiveBuffer
+   *  \param elementSize size of that element, or 0 if unknown
+   */
+  void
+  makeRoomForNextElement(size_t elementSize);
+
+  /** \brief let CoDel decide on the packet at \p index in m_sendQueue, which is leaving the queue
+   *  \param queueBytes octets in m_sendQueue from that packet onward
+   *  \return false if the packet has been dropped and erased from m_sendQueue
+   */
+  bool
+  applyCodel(size_t index, size_t queueBytes, time::steady_clock::TimePoint now);
+
+private:
+  struct QueuedPacket
+  {
+    Block packet;
+    time::steady_clock::TimePoint enqueueTime;
+  };
+
+  /** \brief receive buffer obtained from getStreamReceiveBufferPool()
+   *
+   *  The buffer has room for several packets. Bytes are appended after the previously received
+   *  ones, and decoded elements share ownership of the buffer, so that the bytes are not copied.
+   *  The buffer is replaced whenever it is still referenced and would otherwise be overwritten.
+   */
+  shared_ptr<ndn::Buffer> m_receiveBuffer;
+  /// offset of the first byte in m_receiveBuffer that does not belong to a decoded element
+  size_t m_receiveBufferOffset;
+  /// offset past the last received byte in m_receiveBuffer
   size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
+  std::deque<QueuedPacket> m_sendQueue;
   size_t m_sendQueueBytes;
+  size_t m_sendQueueLimit;
+  /// number of packets at the front of m_sendQueue that are being written
+  size_t m_nSendingPackets;
+  unique_ptr<Codel> m_codel;
+  bool m_isCodelBypassed;
 };
 
+template<class T>
+constexpr size_t StreamTransport<T>::MAX_SEND_BATCH_BYTES;
+
 
 template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
+  , m_receiveBuffer(getStreamReceiveBufferPool().acquire())
+  , m_receiveBufferOffset(0)
   , m_receiveBufferSize(0)
   , m_sendQueueBytes(0)
+  , m_sendQueueLimit(0)
+  , m_nSendingPackets(0)
+  , m_isCodelBypassed(false)
 {
-  // No queue capacity is set because there is no theoretical limit to the size of m_sendQueue.
-  // Therefore, protecting against send queue overflows is less critical than in other transport
-  // types. Instead, we use the default threshold specified in the GenericLinkService options.
+  // No queue capacity is set because m_sendQueue is limited only to bound memory usage, and
+  // its limit is much larger than a useful congestion threshold. Instead, we use the default
+  // threshold specified in the GenericLinkService options.
+
+  // reading the queue length from the socket is a system call
+  this->setSendQueueSamplingInterval(SOCKET_SEND_QUEUE_SAMPLING_INTERVAL);
 
   startReceive();
 }
 
+template<class T>
+const typename StreamTransport<T>::Counters&
+StreamTransport<T>::getCounters() const
+{
+  return *this;
+}
+
+template<class T>
+void
+StreamTransport<T>::reportExtendedCounters(const CounterReporter& report) const
+{
+  report("nInBytesCopied", nInBytesCopied);
+  report("nOutQueueDequeued", nOutQueueDequeued);
+  report("outQueueSojournTime", outQueueSojournTime);
+  report("nOutCodelDropped", nOutCodelDropped);
+  report("nOutQueueOverflow", nOutQueueOverflow);
+}
+
 template<class T>
 ssize_t
 StreamTransport<T>::getSendQueueLength()
@@ -131,6 +289,14 @@ StreamTransport<T>::getSendQueueLength()
   return getSendQueueBytes() + std::max<ssize_t>(0, queueLength);
 }
 
+template<class T>
+void
+StreamTransport<T>::enableCodel(const Codel::Options& options, bool isMarkedUpstream)
+{
+  m_codel = make_unique<Codel>(options);
+  m_isCodelBypassed = isMarkedUpstream;
+}
+
 template<class T>
 void
 StreamTransport<T>::doClose()
@@ -188,9 +354,17 @@ StreamTransport<T>::doSend(const Block& packet)
     return;
 
   bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet);
+  if (!wasQueueEmpty && m_sendQueueLimit > 0 && m_sendQueueBytes + packet.size() > m_sendQueueLimit) {
+    NFD_LOG_FACE_DEBUG("Send queue is full: DROP");
+    ++this->nOutQueueOverflow;
+    return;
+  }
+
+  m_sendQueue.push_back({packet, time::steady_clock::now()});
   m_sendQueueBytes += packet.size();
 
+  // if a write is in progress, the packet is sent together with the
+  // others queued in the meantime once that write completes
   if (wasQueueEmpty)
     sendFromQueue();
 }
@@ -199,7 +373,40 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  BOOST_ASSERT(!m_sendQueue.empty());
+  BOOST_ASSERT(m_nSendingPackets == 0);
+
+  // the Blocks stay in m_sendQueue until the write completes, which keeps the buffers valid
+  auto now = time::steady_clock::now();
+  bool wantCodel = m_codel != nullptr && !m_isCodelBypassed;
+  size_t nPackets = 0;
+  size_t nBytes = 0;
+  while (nPackets < m_sendQueue.size()) {
+    size_t packetSize = m_sendQueue[nPackets].packet.size();
+    if (nPackets > 0 && nBytes + packetSize > MAX_SEND_BATCH_BYTES)
+      break;
+    if (wantCodel && !applyCodel(nPackets, m_sendQueueBytes - nBytes, now))
+      continue;
+    nBytes += packetSize;
+    ++nPackets;
+  }
+
+  if (nPackets == 0) {
+    // CoDel has dropped every queued packet
+    BOOST_ASSERT(m_sendQueue.empty());
+    return;
+  }
+
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    buffers.push_back(boost::asio::buffer(m_sendQueue[i].packet));
+    ++this->nOutQueueDequeued;
+    this->outQueueSojournTime += now - m_sendQueue[i].enqueueTime;
+  }
+  m_nSendingPackets = nPackets;
+
+  boost::asio::async_write(m_socket, buffers,
                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
@@ -211,12 +418,17 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes in " <<
+                     m_nSendingPackets << " packet(s)");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
-  m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+  BOOST_ASSERT(m_sendQueue.size() >= m_nSendingPackets);
+  size_t nBytesDequeued = 0;
+  for (; m_nSendingPackets > 0; --m_nSendingPackets) {
+    nBytesDequeued += m_sendQueue.front().packet.size();
+    m_sendQueue.pop_front();
+  }
+  BOOST_ASSERT(nBytesDequeued == nBytesSent);
+  m_sendQueueBytes -= nBytesDequeued;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
@@ -228,8 +440,8 @@ StreamTransport<T>::startReceive()
 {
   BOOST_ASSERT(getState() == TransportState::UP);
 
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer + m_receiveBufferSize,
-                                             ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize),
+  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer->data() + m_receiveBufferSize,
+                                             m_receiveBuffer->size() - m_receiveBufferSize),
                          [this] (auto&&... args) { this->handleReceive(std::forward<decltype(args)>(args)...); });
 }
 
@@ -244,38 +456,116 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
   m_receiveBufferSize += nBytesReceived;
-  size_t offset = 0;
   bool isOk = true;
-  while (m_receiveBufferSize - offset > 0) {
+  size_t elementSize = 0;
+  while (m_receiveBufferSize - m_receiveBufferOffset > 0) {
     Block element;
-    std::tie(isOk, element) = Block::fromBuffer(m_receiveBuffer + offset, m_receiveBufferSize - offset);
+    std::tie(isOk, element, elementSize) = decodeElement(m_receiveBufferOffset);
     if (!isOk)
       break;
 
-    offset += element.size();
-    BOOST_ASSERT(offset <= m_receiveBufferSize);
+    m_receiveBufferOffset += element.size();
+    BOOST_ASSERT(m_receiveBufferOffset <= m_receiveBufferSize);
 
     this->receive(element);
   }
 
-  if (!isOk && m_receiveBufferSize == ndn::MAX_NDN_PACKET_SIZE && offset == 0) {
+  if (!isOk && (elementSize > ndn::MAX_NDN_PACKET_SIZE ||
+                m_receiveBufferSize - m_receiveBufferOffset >= ndn::MAX_NDN_PACKET_SIZE)) {
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
     return;
   }
 
-  if (offset > 0) {
-    if (offset != m_receiveBufferSize) {
-      std::copy(m_receiveBuffer + offset, m_receiveBuffer + m_receiveBufferSize, m_receiveBuffer);
-      m_receiveBufferSize -= offset;
+  makeRoomForNextElement(isOk ? 0 : elementSize);
+  startReceive();
+}
+
+template<class T>
+void
+StreamTransport<T>::makeRoomForNextElement(size_t elementSize)
+{
+  size_t nPendingBytes = m_receiveBufferSize - m_receiveBufferOffset;
+  bool isShared = m_receiveBuffer.use_count() > 1;
+
+  if (nPendingBytes == 0) {
+    // nothing to move: start over at the beginning of this buffer if no decoded element
+    // refers to it, or continue in a fresh buffer if there is too little room left
+    if (!isShared) {
+      m_receiveBufferOffset = m_receiveBufferSize = 0;
     }
-    else {
-      m_receiveBufferSize = 0;
+    else if (m_receiveBuffer->size() - m_receiveBufferSize < ndn::MAX_NDN_PACKET_SIZE) {
+      m_receiveBuffer = getStreamReceiveBufferPool().acquire();
+      m_receiveBufferOffset = m_receiveBufferSize = 0;
     }
+    return;
   }
 
-  startReceive();
+  // if the TLV header is incomplete, assume the element can have the maximum size
+  size_t neededSize = elementSize > 0 ? elementSize : ndn::MAX_NDN_PACKET_SIZE;
+  if (m_receiveBufferOffset + neededSize <= m_receiveBuffer->size()) {
+    // the element will be completed in place
+    return;
+  }
+
+  if (isShared) {
+    // decoded elements still refer to the buffer, continue in a fresh one
+    auto buffer = getStreamReceiveBufferPool().acquire();
+    std::copy_n(m_receiveBuffer->data() + m_receiveBufferOffset, nPendingBytes, buffer->data());
+    m_receiveBuffer = std::move(buffer);
+  }
+  else {
+    std::copy(m_receiveBuffer->data() + m_receiveBufferOffset, m_receiveBuffer->data() + m_receiveBufferSize,
+              m_receiveBuffer->data());
+  }
+  nInBytesCopied += nPendingBytes;
+  m_receiveBufferOffset = 0;
+  m_receiveBufferSize = nPendingBytes;
+}
+
+template<class T>
+bool
+StreamTransport<T>::applyCodel(size_t index, size_t queueBytes, time::steady_clock::TimePoint now)
+{
+  QueuedPacket& queued = m_sendQueue[index];
+  time::nanoseconds sojournTime = now - queued.enqueueTime;
+  if (!m_codel->shouldDrop(sojournTime, queueBytes, now)) {
+    return true;
+  }
+
+  NFD_LOG_FACE_DEBUG("CoDel: DROP sojourn=" << time::duration_cast<time::microseconds>(sojournTime));
+  m_sendQueueBytes -= queued.packet.size();
+  m_sendQueue.erase(m_sendQueue.begin() + index);
+  ++this->nOutCodelDropped;
+  return false;
+}
+
+template<class T>
+std::tuple<bool, Block, size_t>
+StreamTransport<T>::decodeElement(size_t offset) const
+{
+  auto begin = m_receiveBuffer->cbegin() + offset;
+  auto end = m_receiveBuffer->cbegin() + m_receiveBufferSize;
+
+  // Block::fromBuffer(ConstBufferPtr, size_t) would parse up to the end of the buffer,
+  // which includes stale bytes, so the TLV header is parsed here against the received bytes
+  auto pos = begin;
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length)) {
+    return std::make_tuple(false, Block(), 0);
+  }
+
+  size_t headerSize = static_cast<size_t>(pos - begin);
+  if (length > static_cast<uint64_t>(end - pos)) {
+    // saturate, so that an oversized length is still recognized as too large
+    size_t elementSize = length > ndn::MAX_NDN_PACKET_SIZE ? ndn::MAX_NDN_PACKET_SIZE + 1 :
+                                                              headerSize + static_cast<size_t>(length);
+    return std::make_tuple(false, Block(), elementSize);
+  }
+
+  return std::make_tuple(true, Block(m_receiveBuffer, begin, pos + length), headerSize + length);
 }
 
 template<class T>
@@ -313,6 +603,11 @@ template<class T>
 void
 StreamTransport<T>::resetReceiveBuffer()
 {
+  if (m_receiveBuffer.use_count() > 1) {
+    // decoded elements still refer to the buffer, which must not be overwritten
+    m_receiveBuffer = getStreamReceiveBufferPool().acquire();
+  }
+  m_receiveBufferOffset = 0;
   m_receiveBufferSize = 0;
 }
 
@@ -320,9 +615,10 @@ template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
+  std::deque<QueuedPacket> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
   m_sendQueueBytes = 0;
+  m_nSendingPackets = 0;
 }
 
 template<class T>
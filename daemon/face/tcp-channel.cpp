@@ -37,12 +37,15 @@ NFD_LOG_INIT(TcpChannel);
 namespace ip = boost::asio::ip;
 
 TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
-                       DetermineFaceScopeFromAddress determineFaceScope)
+                       DetermineFaceScopeFromAddress determineFaceScope,
+                       bool wantCodel, size_t sendQueueLimit)
   : m_localEndpoint(localEndpoint)
   , m_acceptor(getGlobalIoService())
   , m_socket(getGlobalIoService())
   , m_wantCongestionMarking(wantCongestionMarking)
   , m_determineFaceScope(std::move(determineFaceScope))
+  , m_wantCodel(wantCodel)
+  , m_sendQueueLimit(sendQueueLimit)
 {
   setUri(FaceUri(m_localEndpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
@@ -128,6 +131,12 @@ TcpChannel::createFace(ip::tcp::socket&& socket,
     auto faceScope = m_determineFaceScope(socket.local_endpoint().address(),
                                           socket.remote_endpoint().address());
     auto transport = make_unique<TcpTransport>(std::move(socket), params.persistency, faceScope);
+    if (m_wantCodel && faceScope == ndn::nfd::FACE_SCOPE_NON_LOCAL) {
+      // a standing queue towards a remote node only adds delay; CoDel is bypassed
+      // when the link service already signals congestion on this queue with CongestionMarks
+      transport->enableCodel(Codel::Options(), options.allowCongestionMarking);
+    }
+    transport->setSendQueueLimit(m_sendQueueLimit);
     face = make_shared<Face>(std::move(linkService), std::move(transport));
     face->setChannel(shared_from_this()); // use weak_from_this() in C++17
 
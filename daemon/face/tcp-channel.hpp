@@ -54,9 +54,15 @@ public:
    *
    * To enable creation faces upon incoming connections,
    * one needs to explicitly call TcpChannel::listen method.
+   *
+   * If \p wantCodel is true, CoDel manages the send queue of non-local faces created by this
+   * channel. \p sendQueueLimit is the maximum number of octets in the send queue of each face,
+   * or 0 for no limit.
    */
   TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
-             DetermineFaceScopeFromAddress determineFaceScope);
+             DetermineFaceScopeFromAddress determineFaceScope,
+             bool wantCodel = false,
+             size_t sendQueueLimit = 0);
 
   bool
   isListening() const override
@@ -130,6 +136,8 @@ private:
   std::map<tcp::Endpoint, shared_ptr<Face>> m_channelFaces;
   bool m_wantCongestionMarking;
   DetermineFaceScopeFromAddress m_determineFaceScope;
+  bool m_wantCodel;
+  size_t m_sendQueueLimit;
 };
 
 } // namespace face
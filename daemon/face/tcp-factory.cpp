@@ -50,6 +50,8 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   port 6363
   //   enable_v4 yes
   //   enable_v6 yes
+  //   codel no
+  //   send_queue_limit 0
   // }
 
   m_wantCongestionMarking = context.generalConfig.wantCongestionMarking;
@@ -65,6 +67,8 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
   uint16_t port = 6363;
   bool enableV4 = true;
   bool enableV6 = true;
+  bool wantCodel = false;
+  size_t sendQueueLimit = 0;
   IpAddressPredicate local;
   bool isLocalConfigured = false;
 
@@ -83,6 +87,12 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
     else if (key == "enable_v6") {
       enableV6 = ConfigFile::parseYesNo(pair, "face_system.tcp");
     }
+    else if (key == "codel") {
+      wantCodel = ConfigFile::parseYesNo(pair, "face_system.tcp");
+    }
+    else if (key == "send_queue_limit") {
+      sendQueueLimit = ConfigFile::parseNumber<size_t>(pair, "face_system.tcp");
+    }
     else if (key == "local") {
       isLocalConfigured = true;
       for (const auto& localPair : pair.second) {
@@ -116,6 +126,12 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
     return;
   }
 
+  if ((m_wantCodel != wantCodel || m_sendQueueLimit != sendQueueLimit) && !m_channels.empty()) {
+    NFD_LOG_WARN("Cannot change codel or send_queue_limit on existing channels and faces");
+  }
+  m_wantCodel = wantCodel;
+  m_sendQueueLimit = sendQueueLimit;
+
   providedSchemes.insert("tcp");
 
   if (enableV4) {
@@ -201,7 +217,8 @@ TcpFactory::createChannel(const tcp::Endpoint& endpoint)
     return it->second;
 
   auto channel = make_shared<TcpChannel>(endpoint, m_wantCongestionMarking,
-                                         bind(&TcpFactory::determineFaceScopeFromAddresses, this, _1, _2));
+                                         bind(&TcpFactory::determineFaceScopeFromAddresses, this, _1, _2),
+                                         m_wantCodel, m_sendQueueLimit);
   m_channels[endpoint] = channel;
   return channel;
 }
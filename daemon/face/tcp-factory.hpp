@@ -77,6 +77,8 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  bool m_wantCodel = false;
+  size_t m_sendQueueLimit = 0;
   std::map<tcp::Endpoint, shared_ptr<TcpChannel>> m_channels;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
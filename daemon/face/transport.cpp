@@ -58,6 +58,11 @@ Transport::Transport()
   , m_linkType(ndn::nfd::LINK_TYPE_NONE)
   , m_mtu(MTU_INVALID)
   , m_sendQueueCapacity(QUEUE_UNSUPPORTED)
+  , m_sendQueueSamplingInterval(0)
+  , m_nextSendQueueSample(time::steady_clock::TimePoint::min())
+  , m_lastSendQueueSample(0)
+  , m_nOutBytesAtSendQueueSample(0)
+  , m_isSendQueueSampleConfirmed(false)
   , m_state(TransportState::UP)
   , m_expirationTime(time::steady_clock::TimePoint::max())
 {
@@ -75,6 +80,11 @@ Transport::setFaceAndLinkService(Face& face, LinkService& service)
   m_service = &service;
 }
 
+void
+Transport::reportExtendedCounters(const CounterReporter& report) const
+{
+}
+
 void
 Transport::close()
 {
@@ -109,6 +119,37 @@ Transport::send(const Block& packet)
   this->doSend(packet);
 }
 
+ssize_t
+Transport::estimateSendQueueLength(size_t threshold)
+{
+  if (m_sendQueueSamplingInterval <= time::nanoseconds::zero()) {
+    return this->getSendQueueLength();
+  }
+
+  auto now = time::steady_clock::now();
+  uint64_t nOutBytes = this->nOutBytes;
+  bool isConfirmation = now < m_nextSendQueueSample;
+  if (isConfirmation) {
+    size_t estimate = m_lastSendQueueSample + (nOutBytes - m_nOutBytesAtSendQueueSample);
+    if (estimate <= threshold || m_lastSendQueueSample > threshold || m_isSendQueueSampleConfirmed) {
+      return estimate;
+    }
+  }
+
+  ssize_t queueLength = this->getSendQueueLength();
+  if (queueLength < 0) {
+    return queueLength;
+  }
+  m_lastSendQueueSample = queueLength;
+  m_nOutBytesAtSendQueueSample = nOutBytes;
+  m_isSendQueueSampleConfirmed = isConfirmation;
+  if (!isConfirmation) {
+    // a confirming sample does not extend the interval
+    m_nextSendQueueSample = now + m_sendQueueSamplingInterval;
+  }
+  return queueLength;
+}
+
 void
 Transport::receive(const Block& packet, const EndpointId& endpoint)
 {
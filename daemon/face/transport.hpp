@@ -102,6 +102,11 @@ const ssize_t QUEUE_UNSUPPORTED = -1;
  */
 const ssize_t QUEUE_ERROR = -2;
 
+/** \brief minimum interval between kernel reads of the send queue length of a socket-based
+ *         transport, when the send queue length is estimated for congestion detection
+ */
+const time::nanoseconds SOCKET_SEND_QUEUE_SAMPLING_INTERVAL = time::milliseconds(1);
+
 /** \brief The lower half of a Face.
  *  \sa Face
  */
@@ -151,6 +156,18 @@ public:
   virtual const Counters&
   getCounters() const;
 
+  /** \brief a function that receives the name and the value of a counter
+   */
+  using CounterReporter = std::function<void(const std::string& name, uint64_t value)>;
+
+  /** \brief reports the counters of this transport type that are not in Transport::Counters
+   *
+   *  Management uses this to publish such counters without knowing the transport type.
+   *  The base class implementation reports nothing.
+   */
+  virtual void
+  reportExtendedCounters(const CounterReporter& report) const;
+
 public: // upper interface
   /** \brief Request the transport to be closed
    *
@@ -242,6 +259,17 @@ public: // dynamic properties
    */
   signal::Signal<Transport, TransportState/*old*/, TransportState/*new*/> afterStateChange;
 
+  /** \brief signals before a burst of packets obtained from the underlying socket in one read
+   *
+   *  Every packet passed to the upper layer until afterReceiveBurst belongs to the burst.
+   *  A transport that reads one packet at a time does not emit this signal.
+   */
+  signal::Signal<Transport> beforeReceiveBurst;
+
+  /** \brief signals after the last packet of a burst has been passed to the upper layer
+   */
+  signal::Signal<Transport> afterReceiveBurst;
+
   /** \return expiration time of the transport
    *  \retval time::steady_clock::TimePoint::max() the transport has indefinite lifetime
    */
@@ -258,6 +286,24 @@ public: // dynamic properties
     return QUEUE_UNSUPPORTED;
   }
 
+  /** \brief estimate the send queue length for comparison with a congestion threshold
+   *  \param threshold the threshold (in octets) that the caller compares the estimate with
+   *  \return an estimate that is not less than the current send queue length (in octets),
+   *           or QUEUE_UNSUPPORTED or QUEUE_ERROR as returned by getSendQueueLength()
+   *
+   *  If send queue sampling is disabled, this returns getSendQueueLength(). Otherwise,
+   *  getSendQueueLength() is sampled at most once per sampling interval, and the estimate
+   *  in between is the last sample plus the octets sent since that sample. The estimate
+   *  ignores what has drained from the queue since the sample. So an estimate at or below
+   *  \p threshold is always accurate enough for the comparison. When the estimate rises above
+   *  \p threshold while the last sample was at or below it, one additional sample is taken to
+   *  confirm it, at most once per sampling interval, so that the queue length is read at most
+   *  twice per interval. Until the interval elapses, later estimates build on that sample, and
+   *  an estimate above \p threshold is returned as is, even if the queue has drained since.
+   */
+  ssize_t
+  estimateSendQueueLength(size_t threshold);
+
 protected: // upper interface to be invoked by subclass
   /** \brief Pass a received link-layer packet to the upper layer for further processing
    *  \param packet the received packet, must be a valid and well-formed TLV block
@@ -267,6 +313,26 @@ protected: // upper interface to be invoked by subclass
   void
   receive(const Block& packet, const EndpointId& endpoint = 0);
 
+  /** \brief Emit beforeReceiveBurst
+   *
+   *  A subclass that obtains several packets in one read invokes this before passing them to
+   *  receive(), and must invoke endReceiveBurst() after the last one, even if the transport
+   *  has been closed in the meantime.
+   */
+  void
+  beginReceiveBurst()
+  {
+    beforeReceiveBurst();
+  }
+
+  /** \brief Emit afterReceiveBurst
+   */
+  void
+  endReceiveBurst()
+  {
+    afterReceiveBurst();
+  }
+
 protected: // properties to be set by subclass
   void
   setLocalUri(const FaceUri& uri);
@@ -286,6 +352,14 @@ protected: // properties to be set by subclass
   void
   setSendQueueCapacity(ssize_t sendQueueCapacity);
 
+  /** \brief set the minimum interval between samples of getSendQueueLength()
+   *         in estimateSendQueueLength()
+   *
+   *  Zero, the initial value, disables sampling, so that every estimate reads the queue length.
+   */
+  void
+  setSendQueueSamplingInterval(time::nanoseconds interval);
+
   /** \brief set transport state
    *
    *  Only the following transitions are valid:
@@ -347,6 +421,12 @@ private:
   ndn::nfd::LinkType m_linkType;
   ssize_t m_mtu;
   ssize_t m_sendQueueCapacity;
+  time::nanoseconds m_sendQueueSamplingInterval;
+  time::steady_clock::TimePoint m_nextSendQueueSample;
+  size_t m_lastSendQueueSample;
+  uint64_t m_nOutBytesAtSendQueueSample;
+  /// whether a confirming sample has been taken in the current sampling interval
+  bool m_isSendQueueSampleConfirmed;
   TransportState m_state;
   time::steady_clock::TimePoint m_expirationTime;
 };
@@ -447,6 +527,13 @@ Transport::setSendQueueCapacity(ssize_t sendQueueCapacity)
   m_sendQueueCapacity = sendQueueCapacity;
 }
 
+inline void
+Transport::setSendQueueSamplingInterval(time::nanoseconds interval)
+{
+  m_sendQueueSamplingInterval = interval;
+  m_nextSendQueueSample = time::steady_clock::TimePoint::min();
+}
+
 inline TransportState
 Transport::getState() const
 {
@@ -26,6 +26,7 @@
 #include "udp-channel.hpp"
 #include "face.hpp"
 #include "generic-link-service.hpp"
+#include "io-thread.hpp"
 #include "unicast-udp-transport.hpp"
 #include "common/global.hpp"
 
@@ -38,11 +39,17 @@ namespace ip = boost::asio::ip;
 
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        time::nanoseconds idleTimeout,
-                       bool wantCongestionMarking)
+                       bool wantCongestionMarking,
+                       size_t receiveBatchSize,
+                       size_t sendBatchSize,
+                       IoThreadPool* ioThreadPool)
   : m_localEndpoint(localEndpoint)
   , m_socket(getGlobalIoService())
   , m_idleFaceTimeout(idleTimeout)
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_receiveBatchSize(receiveBatchSize)
+  , m_sendBatchSize(sendBatchSize)
+  , m_ioThreadPool(ioThreadPool)
 {
   setUri(FaceUri(m_localEndpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
@@ -186,7 +193,9 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
 
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<UnicastUdpTransport>(std::move(socket), params.persistency,
-                                                    m_idleFaceTimeout);
+                                                    m_idleFaceTimeout, m_receiveBatchSize,
+                                                    m_sendBatchSize,
+                                                    m_ioThreadPool ? m_ioThreadPool->next() : nullptr);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
   face->setChannel(shared_from_this()); // use weak_from_this() in C++17
 
@@ -34,6 +34,8 @@
 namespace nfd {
 namespace face {
 
+class IoThreadPool;
+
 /**
  * \brief Class implementing UDP-based channel to create faces
  */
@@ -46,10 +48,17 @@ public:
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call UdpChannel::listen method.
    * The created socket is bound to \p localEndpoint.
+   *
+   * \p receiveBatchSize and \p sendBatchSize are passed to the transports of faces
+   * created by this channel. If \p ioThreadPool is not null, each face performs its socket I/O
+   * on a thread taken from the pool, which must outlive the channel.
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              time::nanoseconds idleTimeout,
-             bool wantCongestionMarking);
+             bool wantCongestionMarking,
+             size_t receiveBatchSize = 1,
+             size_t sendBatchSize = 1,
+             IoThreadPool* ioThreadPool = nullptr);
 
   bool
   isListening() const override
@@ -114,6 +123,9 @@ private:
   std::map<udp::Endpoint, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
   bool m_wantCongestionMarking;
+  size_t m_receiveBatchSize;
+  size_t m_sendBatchSize;
+  IoThreadPool* m_ioThreadPool;
 };
 
 } // namespace face
@@ -40,6 +40,9 @@ namespace net = ndn::net;
 NFD_LOG_INIT(UdpFactory);
 NFD_REGISTER_PROTOCOL_FACTORY(UdpFactory);
 
+const size_t UdpFactory::MAX_RECEIVE_BATCH_SIZE = 256;
+const size_t UdpFactory::MAX_SEND_BATCH_SIZE = 1024; // UIO_MAXIOV
+
 const std::string&
 UdpFactory::getId() noexcept
 {
@@ -66,6 +69,8 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   enable_v4 yes
   //   enable_v6 yes
   //   idle_timeout 600
+  //   recv_batch_size 1
+  //   send_batch_size 1
   //   mcast yes
   //   mcast_group 224.0.23.170
   //   mcast_port 56363
@@ -88,6 +93,8 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   bool enableV4 = false;
   bool enableV6 = false;
   uint32_t idleTimeout = 600;
+  size_t receiveBatchSize = 1;
+  size_t sendBatchSize = 1;
   MulticastConfig mcastConfig;
 
   if (configSection) {
@@ -113,6 +120,20 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         idleTimeout = ConfigFile::parseNumber<uint32_t>(pair, "face_system.udp");
       }
+      else if (key == "recv_batch_size") {
+        receiveBatchSize = ConfigFile::parseNumber<size_t>(pair, "face_system.udp");
+        if (receiveBatchSize < 1 || receiveBatchSize > MAX_RECEIVE_BATCH_SIZE) {
+          NDN_THROW(ConfigFile::Error("face_system.udp.recv_batch_size must be between 1 and " +
+                                      to_string(MAX_RECEIVE_BATCH_SIZE)));
+        }
+      }
+      else if (key == "send_batch_size") {
+        sendBatchSize = ConfigFile::parseNumber<size_t>(pair, "face_system.udp");
+        if (sendBatchSize < 1 || sendBatchSize > MAX_SEND_BATCH_SIZE) {
+          NDN_THROW(ConfigFile::Error("face_system.udp.send_batch_size must be between 1 and " +
+                                      to_string(MAX_SEND_BATCH_SIZE)));
+        }
+      }
       else if (key == "keep_alive_interval") {
         // ignored
       }
@@ -177,6 +198,19 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
     return;
   }
 
+  if (m_receiveBatchSize != receiveBatchSize && !m_channels.empty()) {
+    NFD_LOG_WARN("Cannot change recv_batch_size on existing channels and faces");
+  }
+  if (m_sendBatchSize != sendBatchSize && !m_channels.empty()) {
+    NFD_LOG_WARN("Cannot change send_batch_size on existing channels and faces");
+  }
+  if (m_ioThreadPool != context.ioThreadPool && !m_channels.empty()) {
+    NFD_LOG_WARN("Cannot change I/O threads of existing channels and faces");
+  }
+  m_receiveBatchSize = receiveBatchSize;
+  m_sendBatchSize = sendBatchSize;
+  m_ioThreadPool = context.ioThreadPool;
+
   if (enableV4) {
     udp::Endpoint endpoint(ip::udp::v4(), port);
     shared_ptr<UdpChannel> v4Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
@@ -302,7 +336,10 @@ UdpFactory::createChannel(const udp::Endpoint& localEndpoint,
                     ", endpoint already allocated to a UDP multicast face"));
   }
 
-  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout, m_wantCongestionMarking);
+  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout,
+                                              m_wantCongestionMarking,
+                                              m_receiveBatchSize, m_sendBatchSize,
+                                              m_ioThreadPool);
   m_channels[localEndpoint] = channel;
   return channel;
 }
@@ -356,7 +393,8 @@ UdpFactory::createMulticastFace(const shared_ptr<const net::NetworkInterface>& n
   options.allowCongestionMarking = m_wantCongestionMarking;
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<MulticastUdpTransport>(mcastEp, std::move(rxSock), std::move(txSock),
-                                                      m_mcastConfig.linkType);
+                                                      m_mcastConfig.linkType,
+                                                      m_receiveBatchSize, m_sendBatchSize);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[localEp] = face;
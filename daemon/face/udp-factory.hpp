@@ -46,6 +46,14 @@ public:
   static const std::string&
   getId() noexcept;
 
+  /** \brief upper bound of face_system.udp.recv_batch_size
+   */
+  static const size_t MAX_RECEIVE_BATCH_SIZE;
+
+  /** \brief upper bound of face_system.udp.send_batch_size
+   */
+  static const size_t MAX_SEND_BATCH_SIZE;
+
   explicit
   UdpFactory(const CtorParams& params);
 
@@ -123,6 +131,9 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  size_t m_receiveBatchSize = 1;
+  size_t m_sendBatchSize = 1;
+  IoThreadPool* m_ioThreadPool = nullptr;
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
 
   struct MulticastConfig
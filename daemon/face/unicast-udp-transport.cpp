@@ -41,8 +41,11 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED((DatagramTransport<boost::asio::ip::udp, Unicast
 
 UnicastUdpTransport::UnicastUdpTransport(protocol::socket&& socket,
                                          ndn::nfd::FacePersistency persistency,
-                                         time::nanoseconds idleTimeout)
-  : DatagramTransport(std::move(socket))
+                                         time::nanoseconds idleTimeout,
+                                         size_t receiveBatchSize,
+                                         size_t sendBatchSize,
+                                         shared_ptr<IoThread> ioThread)
+  : DatagramTransport(std::move(socket), receiveBatchSize, sendBatchSize, std::move(ioThread))
   , m_idleTimeout(idleTimeout)
 {
   this->setLocalUri(FaceUri(m_socket.local_endpoint()));
@@ -78,6 +81,9 @@ UnicastUdpTransport::UnicastUdpTransport(protocol::socket&& socket,
       m_idleTimeout > time::nanoseconds::zero()) {
     scheduleClosureWhenIdle();
   }
+
+  // m_socket must not be used after this point
+  offloadSocket();
 }
 
 bool
@@ -41,7 +41,10 @@ class UnicastUdpTransport final : public DatagramTransport<boost::asio::ip::udp,
 public:
   UnicastUdpTransport(protocol::socket&& socket,
                       ndn::nfd::FacePersistency persistency,
-                      time::nanoseconds idleTimeout);
+                      time::nanoseconds idleTimeout,
+                      size_t receiveBatchSize = 1,
+                      size_t sendBatchSize = 1,
+                      shared_ptr<IoThread> ioThread = nullptr);
 
 protected:
   bool
@@ -56,16 +56,35 @@ Forwarder::Forwarder(FaceTable& faceTable)
   m_faceTable.afterAdd.connect([this] (const Face& face) {
     face.afterReceiveInterest.connect(
       [this, &face] (const Interest& interest, const EndpointId& endpointId) {
+        if (m_receiveBurstDepth > 0) {
+          m_receiveBurst.push_back({FaceEndpoint(face, endpointId), interest.shared_from_this(), nullptr});
+          return;
+        }
         this->startProcessInterest(FaceEndpoint(face, endpointId), interest);
       });
     face.afterReceiveData.connect(
       [this, &face] (const Data& data, const EndpointId& endpointId) {
+        if (m_receiveBurstDepth > 0) {
+          m_receiveBurst.push_back({FaceEndpoint(face, endpointId), nullptr, data.shared_from_this()});
+          return;
+        }
         this->startProcessData(FaceEndpoint(face, endpointId), data);
       });
     face.afterReceiveNack.connect(
       [this, &face] (const lp::Nack& nack, const EndpointId& endpointId) {
+        // a Nack must not overtake the Interests and Data received before it
+        this->flushReceiveBurst();
         this->startProcessNack(FaceEndpoint(face, endpointId), nack);
       });
+    face.beforeReceiveBurst.connect([this] {
+      ++m_receiveBurstDepth;
+    });
+    face.afterReceiveBurst.connect([this] {
+      BOOST_ASSERT(m_receiveBurstDepth > 0);
+      if (--m_receiveBurstDepth == 0) {
+        this->flushReceiveBurst();
+      }
+    });
     face.onDroppedInterest.connect(
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(face, interest);
@@ -85,9 +104,76 @@ Forwarder::Forwarder(FaceTable& faceTable)
 
 Forwarder::~Forwarder() = default;
 
+/** \brief number of packets ahead of the packet being processed whose names have been hashed
+ *         and whose NameTree buckets have been prefetched in a batch
+ */
+const size_t BATCH_BUCKET_PREFETCH_DISTANCE = 8;
+
+/** \brief number of packets ahead of the packet being processed whose NameTree entries have been
+ *         prefetched in a batch
+ *
+ *  This is smaller than BATCH_BUCKET_PREFETCH_DISTANCE, so that the buckets read to locate
+ *  the entries have had time to arrive.
+ */
+const size_t BATCH_NODE_PREFETCH_DISTANCE = 4;
+
+void
+Forwarder::startProcessBatch(const std::vector<IncomingPacket>& batch)
+{
+  std::vector<name_tree::HashSequence> hashes(batch.size());
+  size_t nHashed = 0;
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    for (; nHashed < std::min(batch.size(), i + BATCH_BUCKET_PREFETCH_DISTANCE); ++nHashed) {
+      const IncomingPacket& packet = batch[nHashed];
+      if (packet.data != nullptr && packet.data->getTag<lp::PitToken>() != nullptr) {
+        // a valid PIT token leads to the PIT entry without any hashtable lookup
+        continue;
+      }
+      const Name& name = packet.interest != nullptr ? packet.interest->getName() : packet.data->getName();
+      hashes[nHashed] = name_tree::computeHashes(name, std::min(name.size(), NameTree::getMaxDepth()));
+      m_nameTree.prefetchBuckets(hashes[nHashed]);
+    }
+    if (i + BATCH_NODE_PREFETCH_DISTANCE < batch.size()) {
+      m_nameTree.prefetchNodes(hashes[i + BATCH_NODE_PREFETCH_DISTANCE]);
+    }
+
+    const IncomingPacket& packet = batch[i];
+    m_incomingHashes = hashes[i].empty() ? nullptr : &hashes[i];
+    if (packet.interest != nullptr) {
+      this->startProcessInterest(packet.ingress, *packet.interest);
+    }
+    else {
+      this->startProcessData(packet.ingress, *packet.data);
+    }
+    m_incomingHashes = nullptr;
+  }
+}
+
+void
+Forwarder::flushReceiveBurst()
+{
+  if (m_receiveBurst.empty()) {
+    return;
+  }
+
+  std::vector<IncomingPacket> batch;
+  batch.swap(m_receiveBurst);
+  this->startProcessBatch(batch);
+
+  // keep the capacity for the next burst
+  batch.clear();
+  if (m_receiveBurst.empty()) {
+    m_receiveBurst.swap(batch);
+  }
+}
+
 void
 Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& interest)
 {
+  // precomputed name hashes, if any, belong to this Interest only
+  const name_tree::HashSequence* hashes = std::exchange(m_incomingHashes, nullptr);
+
   // receive Interest
   NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName());
   interest.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
@@ -132,7 +218,8 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
   }
 
   // PIT insert
-  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+  shared_ptr<pit::Entry> pitEntry = (hashes == nullptr ? m_pit.insert(interest) :
+                                                         m_pit.insert(interest, *hashes)).first;
 
   // detect duplicate Nonce in PIT entry
   int dnw = fw::findDuplicateNonce(*pitEntry, interest.getNonce(), ingress.face);
@@ -257,8 +344,21 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry,
   // insert out-record
   pitEntry->insertOrUpdateOutRecord(egress, interest);
 
-  // send Interest
-  egress.sendInterest(interest);
+  // send Interest, replacing the downstream PIT token, if any, with one issued by this forwarder;
+  // this is the only place that copies the Interest, because the original may belong to an in-record
+  if (m_isPitTokenIssuingEnabled) {
+    Interest interest2 = interest;
+    interest2.setTag(make_shared<lp::PitToken>(m_pit.issueToken(*pitEntry)));
+    egress.sendInterest(interest2);
+  }
+  else if (interest.getTag<lp::PitToken>() != nullptr) {
+    Interest interest2 = interest;
+    interest2.removeTag<lp::PitToken>();
+    egress.sendInterest(interest2);
+  }
+  else {
+    egress.sendInterest(interest);
+  }
   ++m_counters.nOutInterests;
 }
 
@@ -287,6 +387,9 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
 void
 Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
 {
+  // precomputed name hashes, if any, belong to this Data only
+  const name_tree::HashSequence* hashes = std::exchange(m_incomingHashes, nullptr);
+
   // receive Data
   NFD_LOG_DEBUG("onIncomingData in=" << ingress << " data=" << data.getName());
   data.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
@@ -302,7 +405,19 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   }
 
   // PIT match
-  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  pit::DataMatchResult pitMatches;
+  auto pitToken = data.getTag<lp::PitToken>();
+  if (pitToken != nullptr) {
+    // the upstream's token must not be returned to downstreams
+    data.removeTag<lp::PitToken>();
+    pitMatches = m_pit.findAllDataMatches(data, *pitToken);
+  }
+  else if (hashes != nullptr) {
+    pitMatches = m_pit.findAllDataMatches(data, *hashes);
+  }
+  else {
+    pitMatches = m_pit.findAllDataMatches(data);
+  }
   if (pitMatches.size() == 0) {
     // goto Data unsolicited pipeline
     this->onDataUnsolicited(ingress, data);
@@ -577,8 +692,7 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(pitEntry);
   duration = std::max(duration, 0_ms);
 
-  pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  getTimerWheel().schedule(pitEntry->expiryTimer, duration, [=] { onInterestFinalize(pitEntry); });
 }
 
 void
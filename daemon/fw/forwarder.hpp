@@ -76,7 +76,36 @@ public:
     m_unsolicitedDataPolicy = std::move(policy);
   }
 
+  /** \return whether outgoing Interests carry PIT tokens issued by this forwarder
+   */
+  bool
+  isPitTokenIssuingEnabled() const
+  {
+    return m_isPitTokenIssuingEnabled;
+  }
+
+  /** \brief enable or disable PIT tokens on outgoing Interests
+   *
+   *  When enabled, each outgoing Interest carries a PIT token that refers to its PIT entry.
+   *  An upstream that returns the token with the Data allows the PIT match to skip the NameTree
+   *  lookup. This takes effect only on faces whose link service encodes PIT tokens.
+   */
+  void
+  setPitTokenIssuingEnabled(bool wantEnabled)
+  {
+    m_isPitTokenIssuingEnabled = wantEnabled;
+  }
+
 public: // forwarding entrypoints and tables
+  /** \brief an incoming Interest or Data in a batch passed to startProcessBatch
+   */
+  struct IncomingPacket
+  {
+    FaceEndpoint ingress;
+    shared_ptr<const Interest> interest; ///< null if the packet is a Data
+    shared_ptr<const Data> data;         ///< null if the packet is an Interest
+  };
+
   /** \brief start incoming Interest processing
    *  \param ingress face on which Interest is received and endpoint of the sender
    *  \param interest the incoming Interest, must be well-formed and created with make_shared
@@ -97,6 +126,21 @@ public: // forwarding entrypoints and tables
     this->onIncomingData(ingress, data);
   }
 
+  /** \brief start incoming Interest and Data processing for a batch of packets
+   *
+   *  This has the same effect as calling startProcessInterest or startProcessData on each packet
+   *  in order. Each packet is still processed to completion before the next one, so that it
+   *  observes the table changes made by earlier packets in the same batch. In addition, the name
+   *  of each packet is hashed once and the hash values are passed to the PIT lookup, and the
+   *  NameTree buckets and then the entries needed by the next few packets are prefetched while
+   *  a packet is being processed, so that cache misses in large tables are overlapped.
+   *
+   *  Interests and Data received from a face between Face::beforeReceiveBurst and
+   *  Face::afterReceiveBurst are processed through this function when the burst ends.
+   */
+  void
+  startProcessBatch(const std::vector<IncomingPacket>& batch);
+
   /** \brief start incoming Nack processing
    *  \param ingress face on which Nack is received and endpoint of the sender
    *  \param nack the incoming Nack, must be well-formed
@@ -231,6 +275,12 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onNewNextHop(const Name& prefix, const fib::NextHop& nextHop);
 
+private:
+  /** \brief process the Interests and Data deferred during a receive burst
+   */
+  void
+  flushReceiveBurst();
+
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   /** \brief set a new expiry timer (now + \p duration) on a PIT entry
    */
@@ -263,6 +313,7 @@ private:
 
   FaceTable& m_faceTable;
   unique_ptr<fw::UnsolicitedDataPolicy> m_unsolicitedDataPolicy;
+  bool m_isPitTokenIssuingEnabled = false;
 
   NameTree           m_nameTree;
   Fib                m_fib;
@@ -273,6 +324,13 @@ private:
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
 
+  /// number of receive bursts in progress; Interests and Data are deferred while it is positive
+  int m_receiveBurstDepth = 0;
+  std::vector<IncomingPacket> m_receiveBurst;
+  /// hash values of the name of the packet that startProcessBatch passes to an incoming pipeline,
+  /// taken by that pipeline when it starts
+  const name_tree::HashSequence* m_incomingHashes = nullptr;
+
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
 };
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SHARD_SELECTOR_HPP
+#define NFD_DAEMON_FW_SHARD_SELECTOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief selects the forwarding shard of a packet by a hash of its name prefix
+ *
+ *  A sharded forwarding plane splits NameTree, PIT, CS, and Measurements into \p nShards
+ *  independent table sets. Packets whose names share the first \p prefixLength components are
+ *  assigned to the same shard, so that an Interest, its retransmissions, and the Data that
+ *  satisfies it are processed by the same table set.
+ *
+ *  An implicit digest component at the end of a name is ignored, as it is by the PIT.
+ *  A name with fewer than \p prefixLength components is hashed in full; therefore a Data can only
+ *  be assigned to the shard of a CanBePrefix Interest if the Interest name has at least
+ *  \p prefixLength components.
+ */
+class ShardSelector
+{
+public:
+  /** \param nShards number of shards, must be positive
+   *  \param prefixLength number of leading name components that determine the shard
+   */
+  ShardSelector(size_t nShards, size_t prefixLength);
+
+  size_t
+  getNShards() const
+  {
+    return m_nShards;
+  }
+
+  size_t
+  getPrefixLength() const
+  {
+    return m_prefixLength;
+  }
+
+  /** \return shard index of \p name, in the range [0, getNShards())
+   */
+  size_t
+  operator()(const Name& name) const;
+
+private:
+  size_t m_nShards;
+  size_t m_prefixLength;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SHARD_SELECTOR_HPP
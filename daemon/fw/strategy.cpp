@@ -196,12 +196,7 @@ Strategy::onDroppedInterest(const Face& egress, const Interest& interest)
 void
 Strategy::sendInterest(const shared_ptr<pit::Entry>& pitEntry, Face& egress, const Interest& interest)
 {
-  if (interest.getTag<lp::PitToken>() != nullptr) {
-    Interest interest2 = interest; // make a copy to preserve tag on original packet
-    interest2.removeTag<lp::PitToken>();
-    m_forwarder.onOutgoingInterest(pitEntry, egress, interest2);
-    return;
-  }
+  // the downstream PIT token is removed by the outgoing Interest pipeline
   m_forwarder.onOutgoingInterest(pitEntry, egress, interest);
 }
 
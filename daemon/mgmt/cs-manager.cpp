@@ -24,8 +24,10 @@
  */
 
 #include "cs-manager.hpp"
+#include "status-counter.hpp"
 #include "fw/forwarder-counters.hpp"
 #include "table/cs.hpp"
+#include "table/cs-disk-store.hpp"
 
 #include <ndn-cxx/mgmt/nfd/cs-info.hpp>
 
@@ -45,6 +47,7 @@ CsManager::CsManager(Cs& cs, const ForwarderCounters& fwCounters,
     bind(&CsManager::erase, this, _4, _5));
 
   registerStatusDatasetHandler("info", bind(&CsManager::serveInfo, this, _1, _2, _3));
+  registerStatusDatasetHandler("counters", bind(&CsManager::serveCounters, this, _1, _2, _3));
 }
 
 void
@@ -116,4 +119,20 @@ CsManager::serveInfo(const Name& topPrefix, const Interest& interest,
   context.end();
 }
 
+void
+CsManager::serveCounters(const Name& topPrefix, const Interest& interest,
+                         ndn::mgmt::StatusDatasetContext& context) const
+{
+  context.append(StatusCounter("nBytes", m_cs.getNBytes()).wireEncode());
+  context.append(StatusCounter("byteLimit", m_cs.getByteLimit()).wireEncode());
+
+  const cs::DiskStore* diskStore = m_cs.getDiskStore();
+  if (diskStore != nullptr) {
+    context.append(StatusCounter("disk/capacity", diskStore->getCapacity()).wireEncode());
+    context.append(StatusCounter("disk/nBytes", diskStore->getNBytes()).wireEncode());
+    context.append(StatusCounter("disk/nEntries", diskStore->size()).wireEncode());
+  }
+  context.end();
+}
+
 } // namespace nfd
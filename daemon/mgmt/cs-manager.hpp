@@ -65,6 +65,16 @@ private:
   serveInfo(const Name& topPrefix, const Interest& interest,
             ndn::mgmt::StatusDatasetContext& context) const;
 
+  /** \brief Serve CS counters dataset.
+   *
+   *  This reports, as StatusCounters, the state that CsInfo has no field for:
+   *  "nBytes" and "byteLimit" of the in-memory table, and if the disk tier is enabled,
+   *  "disk/capacity", "disk/nBytes", and "disk/nEntries".
+   */
+  void
+  serveCounters(const Name& topPrefix, const Interest& interest,
+                ndn::mgmt::StatusDatasetContext& context) const;
+
 public:
   static constexpr size_t ERASE_LIMIT = 256;
 
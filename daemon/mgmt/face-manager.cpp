@@ -24,6 +24,7 @@
  */
 
 #include "face-manager.hpp"
+#include "status-counter.hpp"
 
 #include "common/logger.hpp"
 #include "face/generic-link-service.hpp"
@@ -40,6 +41,8 @@ namespace nfd {
 
 NFD_LOG_INIT(FaceManager);
 
+constexpr size_t FaceManager::BIT_EGRESS_SCHEDULING_ENABLED;
+
 FaceManager::FaceManager(FaceSystem& faceSystem,
                          Dispatcher& dispatcher, CommandAuthenticator& authenticator)
   : ManagerBase("faces", dispatcher, authenticator)
@@ -55,6 +58,7 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
   registerStatusDatasetHandler("list", bind(&FaceManager::listFaces, this, _3));
   registerStatusDatasetHandler("channels", bind(&FaceManager::listChannels, this, _3));
   registerStatusDatasetHandler("query", bind(&FaceManager::queryFaces, this, _2, _3));
+  registerStatusDatasetHandler("counters", bind(&FaceManager::listCounters, this, _3));
 
   // register notification stream
   m_postNotification = registerNotificationStream("events");
@@ -176,7 +180,8 @@ makeUpdateFaceResponse(const Face& face)
           .setDefaultCongestionThreshold(options.defaultCongestionThreshold)
           .setFlagBit(ndn::nfd::BIT_LOCAL_FIELDS_ENABLED, options.allowLocalFields, false)
           .setFlagBit(ndn::nfd::BIT_LP_RELIABILITY_ENABLED, options.reliabilityOptions.isEnabled, false)
-          .setFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED, options.allowCongestionMarking, false);
+          .setFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED, options.allowCongestionMarking, false)
+          .setFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED, options.allowEgressScheduling, false);
   }
 
   return params;
@@ -211,6 +216,16 @@ FaceManager::afterCreateFaceSuccess(const shared_ptr<Face>& face,
                (parameters.hasFlagBit(ndn::nfd::BIT_LOCAL_FIELDS_ENABLED) &&
                 !parameters.getFlagBit(ndn::nfd::BIT_LOCAL_FIELDS_ENABLED)));
 
+  // egress scheduling is not among the FaceParams understood by protocol factories,
+  // so it is enabled after the face is created
+  auto linkService = dynamic_cast<face::GenericLinkService*>(face->getLinkService());
+  if (linkService != nullptr && parameters.hasFlagBit(BIT_EGRESS_SCHEDULING_ENABLED) &&
+      parameters.getFlagBit(BIT_EGRESS_SCHEDULING_ENABLED)) {
+    auto options = linkService->getOptions();
+    options.allowEgressScheduling = true;
+    linkService->setOptions(options);
+  }
+
   m_faceTable.add(face);
 
   ControlParameters response = makeCreateFaceResponse(*face);
@@ -236,6 +251,9 @@ updateLinkServiceOptions(Face& face, const ControlParameters& parameters)
   if (parameters.hasFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED)) {
     options.allowCongestionMarking = parameters.getFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED);
   }
+  if (parameters.hasFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED)) {
+    options.allowEgressScheduling = parameters.getFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED);
+  }
   if (parameters.hasBaseCongestionMarkingInterval()) {
     options.baseCongestionMarkingInterval = parameters.getBaseCongestionMarkingInterval();
   }
@@ -354,7 +372,8 @@ copyFaceProperties(const Face& face, T& to)
     const auto& options = linkService->getOptions();
     to.setFlagBit(ndn::nfd::BIT_LOCAL_FIELDS_ENABLED, options.allowLocalFields)
       .setFlagBit(ndn::nfd::BIT_LP_RELIABILITY_ENABLED, options.reliabilityOptions.isEnabled)
-      .setFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED, options.allowCongestionMarking);
+      .setFlagBit(ndn::nfd::BIT_CONGESTION_MARKING_ENABLED, options.allowCongestionMarking)
+      .setFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED, options.allowEgressScheduling);
   }
 }
 
@@ -482,6 +501,18 @@ FaceManager::queryFaces(const Interest& interest,
   context.end();
 }
 
+void
+FaceManager::listCounters(ndn::mgmt::StatusDatasetContext& context)
+{
+  for (const auto& face : m_faceTable) {
+    std::string keyPrefix = to_string(face.getId()) + '/';
+    face.getTransport()->reportExtendedCounters([&] (const std::string& name, uint64_t value) {
+      context.append(StatusCounter(keyPrefix + name, value).wireEncode());
+    });
+  }
+  context.end();
+}
+
 void
 FaceManager::notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind)
 {
@@ -42,6 +42,14 @@ public:
   FaceManager(FaceSystem& faceSystem,
               Dispatcher& dispatcher, CommandAuthenticator& authenticator);
 
+  /** \brief Flags bit in faces/create and faces/update commands that enables per-flow
+   *         egress scheduling on the face
+   *
+   *  This bit is specific to NFD. It is taken from the top of the 64-bit Flags field, so that
+   *  it does not collide with bits that ndn-cxx allocates in ndn::nfd::FaceFlagBit.
+   */
+  static constexpr size_t BIT_EGRESS_SCHEDULING_ENABLED = 63;
+
 private: // ControlCommand
   void
   createFace(const ControlParameters& parameters,
@@ -72,6 +80,14 @@ private: // StatusDataset
   void
   queryFaces(const Interest& interest, ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief lists the transport counters that have no field in FaceStatus
+   *
+   *  Each counter is a StatusCounter whose key is "<FaceId>/<counter name>".
+   *  \sa Transport::reportExtendedCounters
+   */
+  void
+  listCounters(ndn::mgmt::StatusDatasetContext& context);
+
 private: // NotificationStream
   void
   notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind);
@@ -24,6 +24,7 @@
  */
 
 #include "forwarder-status-manager.hpp"
+#include "status-counter.hpp"
 #include "fw/forwarder.hpp"
 #include "core/version.hpp"
 
@@ -38,6 +39,8 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
                                 bind(&ForwarderStatusManager::listGeneralStatus, this, _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/pit", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listPitStatus, this, _1, _2, _3));
 }
 
 ndn::nfd::ForwarderStatus
@@ -83,4 +86,20 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   context.end();
 }
 
+void
+ForwarderStatusManager::listPitStatus(const Name& topPrefix, const Interest& interest,
+                                      ndn::mgmt::StatusDatasetContext& context)
+{
+  const Pit& pit = m_forwarder.getPit();
+  size_t nEntries = pit.size();
+  size_t nReservedBytes = pit.getNReservedBytes();
+
+  context.append(StatusCounter("nEntries", nEntries).wireEncode());
+  context.append(StatusCounter("entrySize", pit.getEntrySize()).wireEncode());
+  context.append(StatusCounter("nReservedBytes", nReservedBytes).wireEncode());
+  context.append(StatusCounter("nReservedBytesPerEntry",
+                               nEntries > 0 ? nReservedBytes / nEntries : 0).wireEncode());
+  context.end();
+}
+
 } // namespace nfd
@@ -53,6 +53,16 @@ private:
   listGeneralStatus(const Name& topPrefix, const Interest& interest,
                     ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief provide PIT memory usage dataset
+   *
+   *  ForwarderStatus has no field for memory usage. This dataset reports it as StatusCounters
+   *  with keys "nEntries", "entrySize", "nReservedBytes", and "nReservedBytesPerEntry".
+   *  \sa Pit::getNReservedBytes
+   */
+  void
+  listPitStatus(const Name& topPrefix, const Interest& interest,
+                ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder& m_forwarder;
   Dispatcher& m_dispatcher;
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "status-counter.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nfd {
+
+StatusCounter::StatusCounter(std::string key, uint64_t value)
+  : m_key(std::move(key))
+  , m_value(value)
+{
+}
+
+StatusCounter::StatusCounter(const Block& wire)
+{
+  wireDecode(wire);
+}
+
+Block
+StatusCounter::wireEncode() const
+{
+  Block wire(tlv::StatusCounter);
+  wire.push_back(ndn::encoding::makeStringBlock(tlv::StatusCounterKey, m_key));
+  wire.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::StatusCounterValue, m_value));
+  wire.encode();
+  return wire;
+}
+
+void
+StatusCounter::wireDecode(const Block& wire)
+{
+  if (wire.type() != tlv::StatusCounter) {
+    NDN_THROW(tlv::Error("Expecting StatusCounter, but TLV-TYPE is " + to_string(wire.type())));
+  }
+  wire.parse();
+
+  auto val = wire.elements_begin();
+  if (val == wire.elements_end() || val->type() != tlv::StatusCounterKey) {
+    NDN_THROW(tlv::Error("Missing required StatusCounterKey field"));
+  }
+  m_key = ndn::encoding::readString(*val);
+
+  ++val;
+  if (val == wire.elements_end() || val->type() != tlv::StatusCounterValue) {
+    NDN_THROW(tlv::Error("Missing required StatusCounterValue field"));
+  }
+  m_value = ndn::encoding::readNonNegativeInteger(*val);
+}
+
+bool
+operator==(const StatusCounter& lhs, const StatusCounter& rhs)
+{
+  return lhs.getKey() == rhs.getKey() && lhs.getValue() == rhs.getValue();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const StatusCounter& counter)
+{
+  return os << counter.getKey() << '=' << counter.getValue();
+}
+
+} // namespace nfd
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_STATUS_COUNTER_HPP
+#define NFD_DAEMON_MGMT_STATUS_COUNTER_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+namespace tlv {
+
+/** \brief TLV-TYPE numbers of NFD-specific status datasets
+ *
+ *  These datasets report state that has no field in the NFD Management Protocol structures
+ *  defined by ndn-cxx. The numbers are outside the range assigned to those structures.
+ */
+enum : uint32_t {
+  StatusCounter      = 0x8F00,
+  StatusCounterKey   = 0x8F01,
+  StatusCounterValue = 0x8F02,
+};
+
+} // namespace tlv
+
+/** \brief a named counter in an NFD-specific status dataset
+ *
+ *  \code
+ *  StatusCounter := STATUS-COUNTER-TYPE TLV-LENGTH
+ *                     StatusCounterKey
+ *                     StatusCounterValue
+ *
+ *  StatusCounterKey := STATUS-COUNTER-KEY-TYPE TLV-LENGTH *OCTET ; UTF-8 string
+ *
+ *  StatusCounterValue := STATUS-COUNTER-VALUE-TYPE TLV-LENGTH NonNegativeInteger
+ *  \endcode
+ *
+ *  A key is a '/'-separated path, such as "257/nReceiveBatches/4", whose meaning is defined by
+ *  the dataset that contains the counter.
+ */
+class StatusCounter
+{
+public:
+  StatusCounter() = default;
+
+  StatusCounter(std::string key, uint64_t value);
+
+  /** \brief decode from \p wire
+   *  \throw tlv::Error \p wire is not a valid StatusCounter
+   */
+  explicit
+  StatusCounter(const Block& wire);
+
+  const std::string&
+  getKey() const
+  {
+    return m_key;
+  }
+
+  uint64_t
+  getValue() const
+  {
+    return m_value;
+  }
+
+  Block
+  wireEncode() const;
+
+  /** \throw tlv::Error \p wire is not a valid StatusCounter
+   */
+  void
+  wireDecode(const Block& wire);
+
+private:
+  std::string m_key;
+  uint64_t m_value = 0;
+};
+
+bool
+operator==(const StatusCounter& lhs, const StatusCounter& rhs);
+
+inline bool
+operator!=(const StatusCounter& lhs, const StatusCounter& rhs)
+{
+  return !(lhs == rhs);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const StatusCounter& counter);
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_STATUS_COUNTER_HPP
@@ -29,9 +29,11 @@
 namespace nfd {
 
 const size_t TablesConfigSection::DEFAULT_CS_MAX_PACKETS = 65536;
+const size_t TablesConfigSection::DEFAULT_CS_DISK_MAX_BYTES = 1073741824;
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
+  , m_csDiskMaxBytes(0)
   , m_isConfigured(false)
 {
 }
@@ -66,6 +68,18 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     nCsMaxPackets = ConfigFile::parseNumber<size_t>(*csMaxPacketsNode, "cs_max_packets", "tables");
   }
 
+  size_t nCsMaxBytes = std::numeric_limits<size_t>::max();
+  OptionalConfigSection csMaxBytesNode = section.get_child_optional("cs_max_bytes");
+  if (csMaxBytesNode) {
+    nCsMaxBytes = ConfigFile::parseNumber<size_t>(*csMaxBytesNode, "cs_max_bytes", "tables");
+  }
+
+  bool isCsSizeAware = false;
+  OptionalConfigSection csSizeAwareNode = section.get_child_optional("cs_size_aware");
+  if (csSizeAwareNode) {
+    isCsSizeAware = ConfigFile::parseYesNo(*csSizeAwareNode, "cs_size_aware", "tables");
+  }
+
   unique_ptr<cs::Policy> csPolicy;
   OptionalConfigSection csPolicyNode = section.get_child_optional("cs_policy");
   if (csPolicyNode) {
@@ -89,6 +103,96 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  std::string csDiskPath;
+  OptionalConfigSection csDiskPathNode = section.get_child_optional("cs_disk_path");
+  if (csDiskPathNode) {
+    csDiskPath = csDiskPathNode->get_value<std::string>();
+    if (csDiskPath.empty()) {
+      NDN_THROW(ConfigFile::Error("Invalid value for option 'cs_disk_path' in section 'tables'"));
+    }
+  }
+
+  size_t csDiskMaxBytes = DEFAULT_CS_DISK_MAX_BYTES;
+  OptionalConfigSection csDiskMaxBytesNode = section.get_child_optional("cs_disk_max_bytes");
+  if (csDiskMaxBytesNode) {
+    csDiskMaxBytes = ConfigFile::parseNumber<size_t>(*csDiskMaxBytesNode, "cs_disk_max_bytes", "tables");
+  }
+
+  name_tree::HashtableType hashtableType = name_tree::HashtableType::CHAINED;
+  OptionalConfigSection hashtableNode = section.get_child_optional("name_tree_hashtable");
+  if (hashtableNode) {
+    std::string hashtableName = hashtableNode->get_value<std::string>();
+    if (hashtableName == "open-addressing") {
+      hashtableType = name_tree::HashtableType::OPEN_ADDRESSING;
+    }
+    else if (hashtableName != "chained") {
+      NDN_THROW(ConfigFile::Error("Unknown name_tree_hashtable '" + hashtableName + "' in section 'tables'"));
+    }
+  }
+
+  DeadNonceListType dnlType = DeadNonceListType::EXACT;
+  OptionalConfigSection dnlNode = section.get_child_optional("dead_nonce_list");
+  if (dnlNode) {
+    std::string dnlName = dnlNode->get_value<std::string>();
+    if (dnlName == "filter") {
+      dnlType = DeadNonceListType::FILTER;
+    }
+    else if (dnlName != "exact") {
+      NDN_THROW(ConfigFile::Error("Unknown dead_nonce_list '" + dnlName + "' in section 'tables'"));
+    }
+  }
+
+  DeadNonceFilter::Options dnlFilterOptions;
+  OptionalConfigSection dnlCapacityNode = section.get_child_optional("dead_nonce_list_capacity");
+  if (dnlCapacityNode) {
+    dnlFilterOptions.capacity = ConfigFile::parseNumber<size_t>(*dnlCapacityNode,
+                                                                "dead_nonce_list_capacity", "tables");
+    if (dnlFilterOptions.capacity == 0) {
+      NDN_THROW(ConfigFile::Error("Invalid value for option 'dead_nonce_list_capacity' in section 'tables'"));
+    }
+  }
+
+  OptionalConfigSection dnlFpRateNode = section.get_child_optional("dead_nonce_list_fp_rate");
+  if (dnlFpRateNode) {
+    dnlFilterOptions.fpRate = ConfigFile::parseNumber<double>(*dnlFpRateNode,
+                                                              "dead_nonce_list_fp_rate", "tables");
+    if (!(dnlFilterOptions.fpRate > 0.0 && dnlFilterOptions.fpRate < 1.0)) {
+      NDN_THROW(ConfigFile::Error("Invalid value for option 'dead_nonce_list_fp_rate' in section 'tables'"));
+    }
+  }
+
+  bool isFibLpmFilterEnabled = false;
+  OptionalConfigSection fibLpmFilterNode = section.get_child_optional("fib_lpm_filter");
+  if (fibLpmFilterNode) {
+    isFibLpmFilterEnabled = ConfigFile::parseYesNo(*fibLpmFilterNode, "fib_lpm_filter", "tables");
+  }
+
+  bool isPitTokenIssuingEnabled = false;
+  OptionalConfigSection pitTokenNode = section.get_child_optional("issue_pit_tokens");
+  if (pitTokenNode) {
+    isPitTokenIssuingEnabled = ConfigFile::parseYesNo(*pitTokenNode, "issue_pit_tokens", "tables");
+  }
+
+  Cs& cs = m_forwarder.getCs();
+  unique_ptr<cs::DiskStore> diskStore;
+  if (!csDiskPath.empty()) {
+    try {
+      if (isDryRun) {
+        cs::DiskStore::checkDirectory(csDiskPath);
+      }
+      else if (cs.getDiskStore() == nullptr ||
+               csDiskPath != m_csDiskPath || csDiskMaxBytes != m_csDiskMaxBytes) {
+        // create the new disk tier before changing anything, so that a failure leaves the
+        // previous configuration in effect; the old disk tier is kept until then
+        diskStore = make_unique<cs::DiskStore>(csDiskPath, csDiskMaxBytes);
+      }
+    }
+    catch (const cs::DiskStore::Error& e) {
+      NDN_THROW_NESTED(ConfigFile::Error("Cannot use cs_disk_path '" + csDiskPath +
+                                         "' in section 'tables': " + e.what()));
+    }
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -103,14 +207,29 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     return;
   }
 
-  Cs& cs = m_forwarder.getCs();
-  cs.setLimit(nCsMaxPackets);
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
+  cs.getPolicy()->setSizeAware(isCsSizeAware);
+  cs.setLimit(nCsMaxPackets);
+  cs.setByteLimit(nCsMaxBytes);
+
+  if (csDiskPath.empty() || diskStore != nullptr) {
+    cs.setDiskStore(std::move(diskStore));
+  }
+  m_csDiskPath = csDiskPath;
+  m_csDiskMaxBytes = csDiskMaxBytes;
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  m_forwarder.getNameTree().setHashtableType(hashtableType);
+
+  m_forwarder.getDeadNonceList().setType(dnlType, dnlFilterOptions);
+
+  m_forwarder.getFib().setLpmFilterEnabled(isFibLpmFilterEnabled);
+
+  m_forwarder.setPitTokenIssuingEnabled(isPitTokenIssuingEnabled);
+
   m_isConfigured = true;
 }
 
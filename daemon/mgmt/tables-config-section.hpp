@@ -38,8 +38,18 @@ namespace nfd {
  *  tables
  *  {
  *    cs_max_packets 65536
+ *    cs_max_bytes 536870912
+ *    cs_size_aware no
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
+ *    cs_disk_path /var/cache/ndn/nfd-cs
+ *    cs_disk_max_bytes 1073741824
+ *    name_tree_hashtable chained
+ *    dead_nonce_list exact
+ *    dead_nonce_list_capacity 1048576
+ *    dead_nonce_list_fp_rate 0.0001
+ *    fib_lpm_filter no
+ *    issue_pit_tokens no
  *
  *    strategy_choice
  *    {
@@ -58,8 +68,13 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
- *      defaults are used if an option is omitted.
+ *  \li cs_max_packets, cs_max_bytes, cs_size_aware, cs_policy, cs_unsolicited_policy,
+ *      name_tree_hashtable, dead_nonce_list, dead_nonce_list_capacity,
+ *      dead_nonce_list_fp_rate, fib_lpm_filter, and issue_pit_tokens are applied; defaults are
+ *      used if an option is omitted.
+ *  \li cs_disk_path and cs_disk_max_bytes are applied; the disk tier of the CS is disabled if
+ *      cs_disk_path is omitted. The disk tier is recreated, and its content discarded, only if
+ *      either option has changed.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
@@ -93,9 +108,14 @@ private:
 
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
+  static const size_t DEFAULT_CS_DISK_MAX_BYTES;
 
   Forwarder& m_forwarder;
 
+  /// cs_disk_path and cs_disk_max_bytes of the current disk tier
+  std::string m_csDiskPath;
+  size_t m_csDiskMaxBytes;
+
   bool m_isConfigured;
 };
 
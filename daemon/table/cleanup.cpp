@@ -30,32 +30,18 @@ namespace nfd {
 void
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face)
 {
-  std::multimap<size_t, const name_tree::Entry*> maybeEmptyNtes;
-
-  // visit FIB and PIT entries in one pass of NameTree enumeration
-  for (const name_tree::Entry& nte : nt) {
-    fib::Entry* fibEntry = nte.getFibEntry();
-    if (fibEntry != nullptr) {
-      fib.removeNextHop(*fibEntry, face);
-    }
-
-    for (const auto& pitEntry : nte.getPitEntries()) {
-      pit.deleteInOutRecords(pitEntry.get(), face);
-    }
-
-    if (!nte.hasTableEntries()) {
-      maybeEmptyNtes.emplace(nte.getName().size(), &nte);
+  for (fib::Entry* fibEntry : fib.getEntriesByFace(face)) {
+    name_tree::Entry* nte = nt.getEntry(*fibEntry);
+    if (fib.removeNextHop(*fibEntry, face) == Fib::RemoveNextHopResult::FIB_ENTRY_REMOVED) {
+      // an entry that still has children is erased together with its last child;
+      // ancestors erased here cannot have FIB entries, so no visited entry is invalidated
+      nt.eraseIfEmpty(nte);
     }
   }
 
-  // try to erase longer names first, so that children are erased before parent is checked
-  for (auto i = maybeEmptyNtes.rbegin(); i != maybeEmptyNtes.rend(); ++i) {
-    nt.eraseIfEmpty(const_cast<name_tree::Entry*>(i->second), false);
+  for (pit::Entry* pitEntry : pit.getEntriesByFace(face)) {
+    pit.deleteInOutRecords(pitEntry, face);
   }
-
-  BOOST_ASSERT(nt.size() == 0 ||
-               std::none_of(nt.begin(), nt.end(),
-                            [] (const name_tree::Entry& nte) { return nte.isEmpty(); }));
 }
 
 } // namespace nfd
@@ -0,0 +1,307 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-disk-store.hpp"
+#include "common/logger.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace cs {
+
+NFD_LOG_INIT(CsDiskStore);
+
+constexpr size_t DiskStore::DEFAULT_SEGMENT_SIZE;
+
+static const std::string SEGMENT_FILE_PREFIX = "segment-";
+
+/** \brief allocates disk blocks for the first \p size octets of a file
+ *  \return zero on success, or an errno value
+ *
+ *  Unlike ftruncate alone, this ensures that a later write through a shared mapping
+ *  cannot fail (with SIGBUS) because the filesystem is full.
+ */
+static int
+allocateFile(int fd, size_t size)
+{
+#ifdef __APPLE__
+  fstore_t store{F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(size), 0};
+  if (::fcntl(fd, F_PREALLOCATE, &store) != 0) {
+    store.fst_flags = F_ALLOCATEALL;
+    if (::fcntl(fd, F_PREALLOCATE, &store) != 0) {
+      return errno;
+    }
+  }
+  return ::ftruncate(fd, static_cast<off_t>(size)) == 0 ? 0 : errno;
+#else
+  return ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+#endif
+}
+
+static void
+createDirectory(const boost::filesystem::path& dir)
+{
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(dir, ec);
+  if (ec) {
+    NDN_THROW(DiskStore::Error("Cannot create " + dir.string() + ": " + ec.message()));
+  }
+}
+
+void
+DiskStore::checkDirectory(const boost::filesystem::path& dir)
+{
+  createDirectory(dir);
+
+  std::string path = (dir / ("check-" + to_string(::getpid()))).string();
+  int fd = ::open(path.data(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0) {
+    NDN_THROW(Error("Cannot create " + path + ": " + std::strerror(errno)));
+  }
+  int err = allocateFile(fd, 4096);
+  ::close(fd);
+  ::unlink(path.data());
+  if (err != 0) {
+    NDN_THROW(Error("Cannot write " + path + ": " + std::strerror(err)));
+  }
+}
+
+DiskStore::DiskStore(const boost::filesystem::path& dir, size_t maxBytes, size_t segmentSize)
+  : m_dir(dir)
+  , m_segmentSize(segmentSize)
+{
+  // segment files of another DiskStore in this process (such as the one being replaced during
+  // a configuration reload) are kept; those left behind by earlier processes are removed
+  static size_t nInstances = 0;
+  std::string processPrefix = SEGMENT_FILE_PREFIX + to_string(::getpid()) + '-';
+  m_fileNamePrefix = processPrefix + to_string(nInstances++) + '-';
+
+  createDirectory(m_dir);
+  removeStaleFiles(processPrefix);
+
+  size_t nSegments = std::max<size_t>(1, maxBytes / segmentSize);
+  for (size_t i = 0; i < nSegments; ++i) {
+    std::string path = getSegmentPath(i);
+
+    int fd = ::open(path.data(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+      std::string reason = std::strerror(errno);
+      releaseSegments();
+      NDN_THROW(Error("Cannot open " + path + ": " + reason));
+    }
+
+    int err = allocateFile(fd, m_segmentSize);
+    if (err != 0) {
+      ::close(fd);
+      ::unlink(path.data());
+      releaseSegments();
+      NDN_THROW(Error("Cannot allocate " + to_string(m_segmentSize) + " bytes for " + path +
+                      ": " + std::strerror(err)));
+    }
+
+    void* base = ::mmap(nullptr, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+      std::string reason = std::strerror(errno);
+      ::close(fd);
+      ::unlink(path.data());
+      releaseSegments();
+      NDN_THROW(Error("Cannot map " + path + ": " + reason));
+    }
+
+    m_segments.push_back({m_nextSeqNo++, fd, static_cast<uint8_t*>(base), 0, {}});
+  }
+
+  NFD_LOG_INFO("Using " << nSegments << " segments of " << m_segmentSize <<
+               " bytes in " << m_dir);
+}
+
+DiskStore::~DiskStore()
+{
+  releaseSegments();
+}
+
+std::string
+DiskStore::getSegmentPath(size_t i) const
+{
+  return (m_dir / (m_fileNamePrefix + to_string(i))).string();
+}
+
+void
+DiskStore::removeStaleFiles(const std::string& processPrefix)
+{
+  boost::system::error_code ec;
+  size_t nRemoved = 0;
+  for (boost::filesystem::directory_iterator it(m_dir, ec), end; !ec && it != end; it.increment(ec)) {
+    std::string fileName = it->path().filename().string();
+    if (fileName.compare(0, SEGMENT_FILE_PREFIX.size(), SEGMENT_FILE_PREFIX) == 0 &&
+        fileName.compare(0, processPrefix.size(), processPrefix) != 0) {
+      boost::system::error_code removeEc;
+      nRemoved += boost::filesystem::remove(it->path(), removeEc);
+    }
+  }
+  if (nRemoved > 0) {
+    NFD_LOG_INFO("Removed " << nRemoved << " stale segment files from " << m_dir);
+  }
+}
+
+void
+DiskStore::releaseSegments()
+{
+  for (const Segment& segment : m_segments) {
+    ::munmap(segment.base, m_segmentSize);
+    ::close(segment.fd);
+  }
+
+  boost::system::error_code ec;
+  for (size_t i = 0; i < m_segments.size(); ++i) {
+    boost::filesystem::remove(getSegmentPath(i), ec);
+  }
+  m_segments.clear();
+}
+
+bool
+DiskStore::insert(const Data& data, time::steady_clock::TimePoint freshUntil)
+{
+  const Block& wire = data.wireEncode();
+  if (wire.size() > m_segmentSize) {
+    return false;
+  }
+
+  if (m_segments.back().used + wire.size() > m_segmentSize) {
+    recycleSegment();
+  }
+  Segment& segment = m_segments.back();
+
+  std::memcpy(segment.base + segment.used, wire.wire(), wire.size());
+  Record record{segment.seqNo, segment.used, wire.size(), freshUntil};
+  segment.used += wire.size();
+  segment.names.push_back(data.getFullName());
+
+  auto res = m_index.emplace(data.getFullName(), record);
+  if (!res.second) {
+    // the same Data was stored before; its old copy becomes unreachable
+    m_nBytes -= res.first->second.size;
+    res.first->second = record;
+  }
+  m_nBytes += record.size;
+
+  NFD_LOG_TRACE("insert " << data.getName() << " segment=" << record.seqNo <<
+                " offset=" << record.offset);
+  return true;
+}
+
+DiskStore::Extracted
+DiskStore::extract(const Interest& interest)
+{
+  const Name& name = interest.getName();
+  bool isFullName = !name.empty() && name[-1].isImplicitSha256Digest();
+  auto now = time::steady_clock::now();
+
+  auto first = m_index.lower_bound(name);
+  auto last = name.empty() ? m_index.end() : m_index.lower_bound(name.getSuccessor());
+  for (auto it = first; it != last; ++it) {
+    // without CanBePrefix, the key must equal the Interest name, or its name plus a digest
+    if (!interest.getCanBePrefix() && it->first.size() != name.size() + (isFullName ? 0 : 1)) {
+      continue;
+    }
+    if (interest.getMustBeFresh() && it->second.freshUntil < now) {
+      continue;
+    }
+
+    const Record& record = it->second;
+    const Segment& segment = getSegment(record);
+    Extracted extracted{make_shared<Data>(Block(segment.base + record.offset, record.size)),
+                        record.freshUntil};
+    NFD_LOG_TRACE("extract " << name << " matching " << it->first);
+    eraseRecord(it);
+    return extracted;
+  }
+
+  return {nullptr, {}};
+}
+
+size_t
+DiskStore::erase(const Name& prefix, size_t limit)
+{
+  auto it = m_index.lower_bound(prefix);
+  auto last = prefix.empty() ? m_index.end() : m_index.lower_bound(prefix.getSuccessor());
+
+  size_t nErased = 0;
+  while (it != last && nErased < limit) {
+    auto next = std::next(it);
+    eraseRecord(it);
+    it = next;
+    ++nErased;
+  }
+  return nErased;
+}
+
+DiskStore::Segment&
+DiskStore::getSegment(const Record& record)
+{
+  BOOST_ASSERT(record.seqNo >= m_segments.front().seqNo);
+  return m_segments[record.seqNo - m_segments.front().seqNo];
+}
+
+void
+DiskStore::recycleSegment()
+{
+  Segment segment = std::move(m_segments.front());
+  m_segments.pop_front();
+
+  size_t nDropped = 0;
+  for (const Name& fullName : segment.names) {
+    auto it = m_index.find(fullName);
+    if (it != m_index.end() && it->second.seqNo == segment.seqNo) {
+      m_nBytes -= it->second.size;
+      m_index.erase(it);
+      ++nDropped;
+    }
+  }
+  NFD_LOG_DEBUG("recycle segment=" << segment.seqNo << " dropped=" << nDropped);
+
+  segment.seqNo = m_nextSeqNo++;
+  segment.used = 0;
+  segment.names.clear();
+  m_segments.push_back(std::move(segment));
+}
+
+void
+DiskStore::eraseRecord(Index::iterator it)
+{
+  // the bytes stay in the segment until it is recycled
+  m_nBytes -= it->second.size;
+  m_index.erase(it);
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
+#define NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
+
+#include "core/common.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <deque>
+
+namespace nfd {
+namespace cs {
+
+/** \brief a second tier of the ContentStore that keeps Data packets on local disk
+ *
+ *  Data packets are appended to a ring of fixed-size segment files, which are memory-mapped.
+ *  An in-memory index, ordered by full name, records the location of each packet.
+ *  When every segment is full, the oldest segment is recycled, dropping the packets it contains.
+ *
+ *  The store is volatile: segment files are created and fully allocated when the store is
+ *  created, and removed when it is destroyed. Their names are unique to the store, so that a
+ *  new store can be created in the same directory before the old one is destroyed.
+ */
+class DiskStore : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /** \brief a Data packet extracted from the store
+   */
+  struct Extracted
+  {
+    shared_ptr<Data> data;
+    time::steady_clock::TimePoint freshUntil;
+  };
+
+  /** \brief create a store in \p dir
+   *  \param dir directory for segment files; created if it does not exist
+   *  \param maxBytes capacity of the store, rounded down to a multiple of \p segmentSize
+   *  \param segmentSize size of each segment file
+   *  \throw Error segment files cannot be created, allocated, or mapped
+   *
+   *  Segment files left in \p dir by an earlier process are removed.
+   */
+  DiskStore(const boost::filesystem::path& dir, size_t maxBytes,
+            size_t segmentSize = DEFAULT_SEGMENT_SIZE);
+
+  ~DiskStore();
+
+  /** \brief check that a store can be created in \p dir, without creating it
+   *
+   *  This creates \p dir if it does not exist, and creates, allocates, and removes a small file.
+   *  \throw Error \p dir is not usable
+   */
+  static void
+  checkDirectory(const boost::filesystem::path& dir);
+
+  /** \brief append a Data packet
+   *  \param freshUntil when the Data becomes non-fresh
+   *  \return whether the Data is stored; a Data larger than a segment is not stored
+   */
+  bool
+  insert(const Data& data, time::steady_clock::TimePoint freshUntil);
+
+  /** \brief find a Data packet that can satisfy \p interest, and remove it from the store
+   *  \return the Data and its freshness, or an Extracted with null data if there is no match
+   */
+  Extracted
+  extract(const Interest& interest);
+
+  /** \brief erase up to \p limit packets under \p prefix
+   *  \return number of erased packets
+   */
+  size_t
+  erase(const Name& prefix, size_t limit);
+
+  /** \brief get number of stored packets
+   */
+  size_t
+  size() const
+  {
+    return m_index.size();
+  }
+
+  /** \brief get total size of stored packets, in bytes
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \brief get capacity, in bytes
+   */
+  size_t
+  getCapacity() const
+  {
+    return m_segmentSize * m_segments.size();
+  }
+
+public:
+  static constexpr size_t DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+private:
+  struct Segment
+  {
+    uint64_t seqNo; ///< increases each time a segment is (re)used
+    int fd;
+    uint8_t* base;
+    size_t used;
+    std::vector<Name> names; ///< full names of packets appended since the segment was (re)used
+  };
+
+  struct Record
+  {
+    uint64_t seqNo; ///< seqNo of the segment holding the packet
+    size_t offset;
+    size_t size;
+    time::steady_clock::TimePoint freshUntil;
+  };
+
+  using Index = std::map<Name, Record>;
+
+  std::string
+  getSegmentPath(size_t i) const;
+
+  /** \brief remove segment files whose names do not start with \p processPrefix
+   */
+  void
+  removeStaleFiles(const std::string& processPrefix);
+
+  /** \brief unmap, close, and remove all segment files
+   */
+  void
+  releaseSegments();
+
+  /** \brief find the segment holding \p record
+   */
+  Segment&
+  getSegment(const Record& record);
+
+  /** \brief recycle the oldest segment and make it the current segment
+   */
+  void
+  recycleSegment();
+
+  void
+  eraseRecord(Index::iterator it);
+
+private:
+  boost::filesystem::path m_dir;
+  std::string m_fileNamePrefix;
+  size_t m_segmentSize;
+  /// all segments, from the oldest to the current one, which receives appended packets
+  std::deque<Segment> m_segments;
+  uint64_t m_nextSeqNo = 0;
+  Index m_index;
+  size_t m_nBytes = 0;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
@@ -24,6 +24,7 @@
  */
 
 #include "cs-entry.hpp"
+#include "name-tree-hashtable.hpp"
 
 namespace nfd {
 namespace cs {
@@ -111,5 +112,18 @@ operator<(const Entry& lhs, const Entry& rhs)
   return compareDataWithData(lhs.getData(), rhs.getData()) < 0;
 }
 
+size_t
+NameRefHash::operator()(const NameRef& ref) const
+{
+  return name_tree::computeHash(*ref.name, ref.prefixLen);
+}
+
+bool
+NameRefEqual::operator()(const NameRef& lhs, const NameRef& rhs) const
+{
+  return lhs.prefixLen == rhs.prefixLen &&
+         lhs.name->compare(0, lhs.prefixLen, *rhs.name, 0, rhs.prefixLen) == 0;
+}
+
 } // namespace cs
 } // namespace nfd
@@ -60,6 +60,14 @@ public: // exposed through ContentStore enumeration
     return m_data->getFullName();
   }
 
+  /** \brief return size of the stored Data, in bytes of its encoding
+   */
+  size_t
+  getSize() const
+  {
+    return m_data->wireEncode().size();
+  }
+
   /** \brief return whether the stored Data is unsolicited
    */
   bool
@@ -86,6 +94,22 @@ public: // used by ContentStore implementation
   void
   updateFreshUntil();
 
+  /** \brief return when the entry becomes non-fresh
+   */
+  time::steady_clock::TimePoint
+  getFreshUntil() const
+  {
+    return m_freshUntil;
+  }
+
+  /** \brief set when the entry becomes non-fresh
+   */
+  void
+  setFreshUntil(time::steady_clock::TimePoint freshUntil)
+  {
+    m_freshUntil = freshUntil;
+  }
+
   /** \brief clear 'unsolicited' flag
    */
   void
@@ -121,6 +145,34 @@ operator<(Table::const_iterator lhs, Table::const_iterator rhs)
   return *lhs < *rhs;
 }
 
+/** \brief refers to a prefix of a Name stored elsewhere, used as a key in NameIndex
+ */
+struct NameRef
+{
+  const Name* name;
+  size_t prefixLen;
+};
+
+struct NameRefHash
+{
+  size_t
+  operator()(const NameRef& ref) const;
+};
+
+struct NameRefEqual
+{
+  bool
+  operator()(const NameRef& lhs, const NameRef& rhs) const;
+};
+
+/** \brief a hash index of Table entries by Data name
+ *
+ *  Entries whose Data have the same name differ only in the implicit digest, so that they are
+ *  adjacent in Table. The index maps a Data name to the first of these entries. The key refers to
+ *  the name of the Data in that entry, so that the index does not store copies of names.
+ */
+using NameIndex = std::unordered_map<NameRef, Table::const_iterator, NameRefHash, NameRefEqual>;
+
 } // namespace cs
 } // namespace nfd
 
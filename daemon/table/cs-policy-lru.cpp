@@ -67,10 +67,11 @@ void
 LruPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     BOOST_ASSERT(!m_queue.empty());
-    EntryRef i = m_queue.front();
-    m_queue.pop_front();
+    auto it = this->selectEvictionCandidate(m_queue.begin(), m_queue.end());
+    EntryRef i = *it;
+    m_queue.erase(it);
     this->emitSignal(beforeEvict, i);
   }
 }
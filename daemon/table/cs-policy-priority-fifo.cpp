@@ -77,7 +77,7 @@ PriorityFifoPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
 
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     this->evictOne();
   }
 }
@@ -89,17 +89,19 @@ PriorityFifoPolicy::evictOne()
                !m_queues[QUEUE_STALE].empty() ||
                !m_queues[QUEUE_FIFO].empty());
 
-  EntryRef i;
+  const Queue* queue = nullptr;
   if (!m_queues[QUEUE_UNSOLICITED].empty()) {
-    i = m_queues[QUEUE_UNSOLICITED].front();
+    queue = &m_queues[QUEUE_UNSOLICITED];
   }
   else if (!m_queues[QUEUE_STALE].empty()) {
-    i = m_queues[QUEUE_STALE].front();
+    queue = &m_queues[QUEUE_STALE];
   }
-  else if (!m_queues[QUEUE_FIFO].empty()) {
-    i = m_queues[QUEUE_FIFO].front();
+  else {
+    queue = &m_queues[QUEUE_FIFO];
   }
 
+  EntryRef i = *this->selectEvictionCandidate(queue->begin(), queue->end());
+
   this->detachQueue(i);
   this->emitSignal(beforeEvict, i);
 }
@@ -35,6 +35,8 @@ NFD_LOG_INIT(CsPolicy);
 namespace nfd {
 namespace cs {
 
+constexpr size_t Policy::SIZE_AWARE_WINDOW;
+
 Policy::Registry&
 Policy::getRegistry()
 {
@@ -72,6 +74,21 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setByteLimit(size_t nMaxBytes)
+{
+  NFD_LOG_INFO("setByteLimit " << nMaxBytes);
+  m_byteLimit = nMaxBytes;
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return m_cs->size() > m_limit || m_cs->getNBytes() > m_byteLimit;
+}
+
 void
 Policy::afterInsert(EntryRef i)
 {
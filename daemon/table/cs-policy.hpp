@@ -104,6 +104,47 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets hard limit (in bytes of stored Data)
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** \brief sets hard limit (in bytes of stored Data)
+   *  \post getByteLimit() == nMaxBytes
+   *  \post cs.getNBytes() <= getByteLimit()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** \brief gets whether eviction favors keeping small entries
+   */
+  bool
+  isSizeAware() const
+  {
+    return m_isSizeAware;
+  }
+
+  /** \brief sets whether eviction favors keeping small entries
+   *
+   *  When enabled, a policy evicts the largest of the first SIZE_AWARE_WINDOW entries
+   *  in its eviction order, instead of the first entry.
+   */
+  void
+  setSizeAware(bool isSizeAware)
+  {
+    m_isSizeAware = isSizeAware;
+  }
+
+public:
+  /** \brief number of eviction candidates considered by size-aware eviction
+   */
+  static constexpr size_t SIZE_AWARE_WINDOW = 8;
+
 public:
   /** \brief a reference to an CS entry
    *  \note operator< of EntryRef compares the Data name enclosed in the Entry.
@@ -189,6 +230,35 @@ protected:
   virtual void
   evictEntries() = 0;
 
+  /** \return whether CS size exceeds either hard limit
+   */
+  bool
+  isOverLimit() const;
+
+  /** \brief selects an eviction candidate in [first, last), according to isSizeAware()
+   *  \tparam It an iterator whose value type is EntryRef
+   *  \pre first != last
+   */
+  template<typename It>
+  It
+  selectEvictionCandidate(It first, It last) const
+  {
+    It selected = first;
+    if (!m_isSizeAware) {
+      return selected;
+    }
+
+    size_t maxSize = (*selected)->getSize();
+    It it = first;
+    for (size_t i = 1; i < SIZE_AWARE_WINDOW && ++it != last; ++i) {
+      if ((*it)->getSize() > maxSize) {
+        selected = it;
+        maxSize = (*it)->getSize();
+      }
+    }
+    return selected;
+  }
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
@@ -202,6 +272,8 @@ private: // registry
 private:
   std::string m_policyName;
   size_t m_limit;
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  bool m_isSizeAware = false;
   Cs* m_cs;
 };
 
@@ -64,9 +64,22 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
   }
 
+  const Block& wire = data.wireEncode();
+  if (wire.size() > m_policy->getByteLimit()) {
+    NFD_LOG_DEBUG("insert " << data.getName() << " too-large");
+    return;
+  }
+
+  // Received packets are decoded in place from receive buffers that can hold a packet of maximum
+  // size; a cached Data should not keep such a buffer alive, so it is copied into its own buffer.
+  shared_ptr<const Data> cached = data.shared_from_this();
+  if (wire.getBuffer()->size() > 2 * wire.size()) {
+    cached = make_shared<Data>(Block(wire.wire(), wire.size()));
+  }
+
   const_iterator it;
   bool isNewEntry = false;
-  std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited);
+  std::tie(it, isNewEntry) = m_table.emplace(std::move(cached), isUnsolicited);
   Entry& entry = const_cast<Entry&>(*it);
 
   entry.updateFreshUntil();
@@ -80,6 +93,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    indexEntry(it);
     m_policy->afterInsert(it);
   }
 }
@@ -104,12 +118,61 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
   size_t nErased = 0;
   while (i != last && nErased < limit) {
     m_policy->beforeErase(i);
-    i = m_table.erase(i);
+    i = eraseEntry(i);
     ++nErased;
   }
+
+  if (m_diskStore != nullptr && nErased < limit) {
+    nErased += m_diskStore->erase(prefix, limit - nErased);
+  }
   return nErased;
 }
 
+Cs::const_iterator
+Cs::eraseEntry(const_iterator it)
+{
+  const Name& name = it->getName();
+  auto indexIt = m_index.find(NameRef{&name, name.size()});
+  BOOST_ASSERT(indexIt != m_index.end());
+
+  m_nBytes -= it->getSize();
+
+  if (indexIt->second == it) {
+    // the index key refers to the name in this entry, so it must be replaced
+    m_index.erase(indexIt);
+    auto next = std::next(it);
+    if (next != m_table.end() && next->getName() == name) {
+      m_index.emplace(NameRef{&next->getName(), name.size()}, next);
+    }
+  }
+
+  return m_table.erase(it);
+}
+
+void
+Cs::evictEntry(const_iterator it)
+{
+  // unsolicited Data were never requested, so they are not worth keeping on disk
+  if (m_diskStore != nullptr && !it->isUnsolicited()) {
+    m_diskStore->insert(it->getData(), it->getFreshUntil());
+  }
+  eraseEntry(it);
+}
+
+void
+Cs::indexEntry(const_iterator it)
+{
+  m_nBytes += it->getSize();
+
+  NameRef key{&it->getName(), it->getName().size()};
+  auto res = m_index.emplace(key, it);
+  if (!res.second && *it < *res.first->second) {
+    // the new entry precedes other entries with the same name
+    m_index.erase(res.first);
+    m_index.emplace(key, it);
+  }
+}
+
 Cs::const_iterator
 Cs::findImpl(const Interest& interest) const
 {
@@ -117,20 +180,81 @@ Cs::findImpl(const Interest& interest) const
     return m_table.end();
   }
 
-  const Name& prefix = interest.getName();
-  auto range = findPrefixRange(prefix);
-  auto match = std::find_if(range.first, range.second,
-                            [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+  auto match = interest.getCanBePrefix() ? findPrefixMatch(interest) : findExactMatch(interest);
 
-  if (match == range.second) {
-    NFD_LOG_DEBUG("find " << prefix << " no-match");
+  if (match == m_table.end()) {
+    NFD_LOG_DEBUG("find " << interest.getName() << " no-match");
     return m_table.end();
   }
-  NFD_LOG_DEBUG("find " << prefix << " matching " << match->getName());
+  NFD_LOG_DEBUG("find " << interest.getName() << " matching " << match->getName());
   m_policy->beforeUse(match);
   return match;
 }
 
+Cs::const_iterator
+Cs::findPrefixMatch(const Interest& interest) const
+{
+  auto range = findPrefixRange(interest.getName());
+  auto match = std::find_if(range.first, range.second,
+                            [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+  return match == range.second ? m_table.end() : match;
+}
+
+Cs::const_iterator
+Cs::findExactMatch(const Interest& interest) const
+{
+  const Name& name = interest.getName();
+  size_t dataNameLen = name.size();
+  if (dataNameLen > 0 && name[-1].isImplicitSha256Digest()) {
+    --dataNameLen;
+  }
+
+  auto indexIt = m_index.find(NameRef{&name, dataNameLen});
+  if (indexIt == m_index.end()) {
+    return m_table.end();
+  }
+
+  // entries with the same Data name are adjacent and differ only in the implicit digest
+  const Name& dataName = indexIt->second->getName();
+  for (auto it = indexIt->second; it != m_table.end() && it->getName() == dataName; ++it) {
+    if (it->canSatisfy(interest)) {
+      return it;
+    }
+  }
+  return m_table.end();
+}
+
+shared_ptr<const Data>
+Cs::promoteFromDisk(const Interest& interest)
+{
+  if (m_diskStore == nullptr || !m_shouldServe || m_policy->getLimit() == 0) {
+    return nullptr;
+  }
+
+  auto extracted = m_diskStore->extract(interest);
+  if (extracted.data == nullptr) {
+    return nullptr;
+  }
+  NFD_LOG_DEBUG("find " << interest.getName() << " promoting " << extracted.data->getName());
+
+  const_iterator it;
+  bool isNewEntry = false;
+  std::tie(it, isNewEntry) = m_table.emplace(extracted.data, false);
+  Entry& entry = const_cast<Entry&>(*it);
+
+  // the policy may evict the promoted entry, so the Data is returned instead of the iterator
+  if (isNewEntry) {
+    entry.setFreshUntil(extracted.freshUntil);
+    indexEntry(it);
+    m_policy->afterInsert(it);
+  }
+  else {
+    entry.setFreshUntil(std::max(entry.getFreshUntil(), extracted.freshUntil));
+    m_policy->afterRefresh(it);
+  }
+  return extracted.data;
+}
+
 void
 Cs::dump()
 {
@@ -146,8 +270,12 @@ Cs::setPolicy(unique_ptr<Policy> policy)
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t byteLimit = m_policy->getByteLimit();
+  bool isSizeAware = m_policy->isSizeAware();
   this->setPolicyImpl(std::move(policy));
   m_policy->setLimit(limit);
+  m_policy->setByteLimit(byteLimit);
+  m_policy->setSizeAware(isSizeAware);
 }
 
 void
@@ -155,12 +283,19 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { m_table.erase(it); });
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { evictEntry(it); });
 
   m_policy->setCs(this);
   BOOST_ASSERT(m_policy->getCs() == this);
 }
 
+void
+Cs::setDiskStore(unique_ptr<DiskStore> diskStore)
+{
+  m_diskStore = std::move(diskStore);
+  NFD_LOG_INFO((m_diskStore != nullptr ? "Enabling" : "Disabling") << " disk tier");
+}
+
 void
 Cs::enableAdmit(bool shouldAdmit)
 {
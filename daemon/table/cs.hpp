@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_CS_HPP
 #define NFD_DAEMON_TABLE_CS_HPP
 
+#include "cs-disk-store.hpp"
 #include "cs-policy.hpp"
 
 namespace nfd {
@@ -39,6 +40,13 @@ namespace cs {
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
+ *  In addition, a NameIndex maps each Data name to its entries in the Table. Lookups of Interests
+ *  without CanBePrefix use this index, while CanBePrefix lookups search the ordered Table.
+ *
+ *  Optionally, entries evicted by the replacement policy are demoted to a DiskStore.
+ *  A lookup that misses the Table is then tried on the DiskStore, and a match found there is
+ *  promoted back to the Table.
+ *
  *  The replacement policy is implemented in a subclass of \c Policy.
  */
 class Cs : noncopyable
@@ -78,14 +86,20 @@ public:
    */
   template<typename HitCallback, typename MissCallback>
   void
-  find(const Interest& interest, HitCallback&& hit, MissCallback&& miss) const
+  find(const Interest& interest, HitCallback&& hit, MissCallback&& miss)
   {
     auto match = findImpl(interest);
-    if (match == m_table.end()) {
-      miss(interest);
+    if (match != m_table.end()) {
+      hit(interest, match->getData());
+      return;
+    }
+
+    auto promoted = promoteFromDisk(interest);
+    if (promoted != nullptr) {
+      hit(interest, *promoted);
       return;
     }
-    hit(interest, match->getData());
+    miss(interest);
   }
 
   /** \brief get number of stored packets
@@ -96,6 +110,14 @@ public:
     return m_table.size();
   }
 
+  /** \brief get total size of stored packets, in bytes
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
 public: // configuration
   /** \brief get capacity (in number of packets)
    */
@@ -113,6 +135,24 @@ public: // configuration
     return m_policy->setLimit(nMaxPackets);
   }
 
+  /** \brief get capacity (in bytes of stored packets)
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_policy->getByteLimit();
+  }
+
+  /** \brief change capacity (in bytes of stored packets)
+   *
+   *  A Data packet larger than this capacity is not admitted.
+   */
+  void
+  setByteLimit(size_t nMaxBytes)
+  {
+    return m_policy->setByteLimit(nMaxBytes);
+  }
+
   /** \brief get replacement policy
    */
   Policy*
@@ -127,6 +167,21 @@ public: // configuration
   void
   setPolicy(unique_ptr<Policy> policy);
 
+  /** \brief get the second-tier store
+   *  \return the DiskStore, or nullptr if evicted entries are discarded
+   */
+  DiskStore*
+  getDiskStore() const
+  {
+    return m_diskStore.get();
+  }
+
+  /** \brief set the second-tier store
+   *  \param diskStore the DiskStore that receives evicted entries, or nullptr to discard them
+   */
+  void
+  setDiskStore(unique_ptr<DiskStore> diskStore);
+
   /** \brief get CS_ENABLE_ADMIT flag
    *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
    */
@@ -179,9 +234,41 @@ private:
   size_t
   eraseImpl(const Name& prefix, size_t limit);
 
+  /** \brief erases an entry from the Table and the NameIndex
+   *  \return iterator following the erased entry
+   */
+  const_iterator
+  eraseEntry(const_iterator it);
+
+  /** \brief adds a new entry to the NameIndex, and counts its bytes
+   */
+  void
+  indexEntry(const_iterator it);
+
+  /** \brief erases an entry evicted by the policy, after demoting it to the DiskStore
+   */
+  void
+  evictEntry(const_iterator it);
+
   const_iterator
   findImpl(const Interest& interest) const;
 
+  /** \brief finds a match for an Interest with CanBePrefix, by searching the Table
+   */
+  const_iterator
+  findPrefixMatch(const Interest& interest) const;
+
+  /** \brief finds a match for an Interest without CanBePrefix, via the NameIndex
+   */
+  const_iterator
+  findExactMatch(const Interest& interest) const;
+
+  /** \brief finds a match in the DiskStore, and moves it to the Table
+   *  \return the matching Data, or nullptr if there is no match
+   */
+  shared_ptr<const Data>
+  promoteFromDisk(const Interest& interest);
+
   void
   setPolicyImpl(unique_ptr<Policy> policy);
 
@@ -191,8 +278,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   Table m_table;
+  NameIndex m_index;
+  size_t m_nBytes = 0;
   unique_ptr<Policy> m_policy;
   signal::ScopedConnection m_beforeEvictConnection;
+  unique_ptr<DiskStore> m_diskStore;
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
   bool m_shouldServe = true; ///< if false, all lookups will miss
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dead-nonce-filter.hpp"
+
+#include <cmath>
+#include <numeric>
+
+namespace nfd {
+
+DeadNonceFilter::DeadNonceFilter(const Options& options)
+  : m_options(options)
+{
+  if (m_options.capacity == 0) {
+    NDN_THROW(std::invalid_argument("capacity must be positive"));
+  }
+  if (!(m_options.fpRate > 0.0 && m_options.fpRate < 1.0)) {
+    NDN_THROW(std::invalid_argument("fpRate must be between 0 and 1"));
+  }
+  if (m_options.nSlices < 2) {
+    NDN_THROW(std::invalid_argument("nSlices must be at least 2"));
+  }
+
+  // A lookup checks every slice, so each slice gets an equal share of the false positive rate.
+  // Each slice must hold the hashes added during one rotation interval.
+  double n = std::ceil(static_cast<double>(m_options.capacity) / (m_options.nSlices - 1));
+  double p = m_options.fpRate / m_options.nSlices;
+  double ln2 = std::log(2.0);
+  double m = std::ceil(-n * std::log(p) / (ln2 * ln2));
+
+  m_nWordsPerSlice = static_cast<size_t>(std::ceil(m / 64));
+  m_nBitsPerSlice = static_cast<uint64_t>(m_nWordsPerSlice) * 64;
+  m_nHashes = std::max<size_t>(1, static_cast<size_t>(std::round(m_nBitsPerSlice / n * ln2)));
+
+  m_bits.resize(m_nWordsPerSlice * m_options.nSlices);
+  m_counts.resize(m_options.nSlices);
+}
+
+bool
+DeadNonceFilter::testSlice(size_t slice, uint64_t hash) const
+{
+  const uint64_t* words = m_bits.data() + slice * m_nWordsPerSlice;
+  for (size_t i = 0; i < m_nHashes; ++i) {
+    uint64_t index = getBitIndex(hash, i);
+    if ((words[index / 64] & (uint64_t(1) << (index % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+DeadNonceFilter::has(uint64_t hash) const
+{
+  // start from the current slice, where recently added hashes are
+  for (size_t i = 0; i < m_options.nSlices; ++i) {
+    size_t slice = (m_current + m_options.nSlices - i) % m_options.nSlices;
+    if (m_counts[slice] > 0 && testSlice(slice, hash)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadNonceFilter::add(uint64_t hash)
+{
+  uint64_t* words = m_bits.data() + m_current * m_nWordsPerSlice;
+  for (size_t i = 0; i < m_nHashes; ++i) {
+    uint64_t index = getBitIndex(hash, i);
+    words[index / 64] |= uint64_t(1) << (index % 64);
+  }
+  ++m_counts[m_current];
+}
+
+void
+DeadNonceFilter::rotate()
+{
+  m_current = (m_current + 1) % m_options.nSlices;
+  auto first = m_bits.begin() + m_current * m_nWordsPerSlice;
+  std::fill(first, first + m_nWordsPerSlice, 0);
+  m_counts[m_current] = 0;
+}
+
+size_t
+DeadNonceFilter::size() const
+{
+  return std::accumulate(m_counts.begin(), m_counts.end(), size_t(0));
+}
+
+} // namespace nfd
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+#define NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+/** \brief A set of 64-bit hashes kept in rotating Bloom filters
+ *
+ *  The filter consists of a fixed number of equally sized slices. Hashes are added to the
+ *  current slice, and a lookup checks all slices. rotate() clears the oldest slice and makes it
+ *  the current slice, so that a hash is remembered for at least nSlices-1 rotations.
+ *
+ *  Memory usage is fixed when the filter is constructed. The false positive rate stays below
+ *  the configured rate as long as no more than \p capacity hashes are added during nSlices-1
+ *  rotations; it increases if more hashes are added.
+ */
+class DeadNonceFilter : noncopyable
+{
+public:
+  class Options
+  {
+  public:
+    Options() noexcept
+    {
+    }
+
+  public:
+    /** \brief number of hashes added during nSlices-1 rotations
+     */
+    size_t capacity = 1 << 20;
+
+    /** \brief expected false positive rate, must be between 0 and 1 exclusive
+     */
+    double fpRate = 0.0001;
+
+    /** \brief number of slices, must be at least 2
+     */
+    size_t nSlices = 4;
+  };
+
+  explicit
+  DeadNonceFilter(const Options& options = {});
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief determine whether \p hash has been added
+   *
+   *  This may return a false positive, but never a false negative for hashes added during
+   *  the last nSlices-1 rotations.
+   */
+  bool
+  has(uint64_t hash) const;
+
+  void
+  add(uint64_t hash);
+
+  /** \brief forget the hashes in the oldest slice, and start adding to it
+   */
+  void
+  rotate();
+
+  /** \return number of hashes added to slices that have not been cleared
+   */
+  size_t
+  size() const;
+
+  /** \return number of octets used by the bit arrays
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_bits.size() * sizeof(uint64_t);
+  }
+
+  /** \return number of bits set for each hash
+   */
+  size_t
+  getNHashes() const
+  {
+    return m_nHashes;
+  }
+
+private:
+  bool
+  testSlice(size_t slice, uint64_t hash) const;
+
+  /** \brief compute the position of the i-th bit of \p hash in a slice
+   *
+   *  This uses double hashing, deriving all positions from the two halves of \p hash.
+   */
+  uint64_t
+  getBitIndex(uint64_t hash, size_t i) const
+  {
+    uint64_t h1 = hash & 0xFFFFFFFF;
+    uint64_t h2 = (hash >> 32) | 1;
+    return (h1 + i * h2) % m_nBitsPerSlice;
+  }
+
+private:
+  Options m_options;
+  size_t m_nWordsPerSlice;
+  uint64_t m_nBitsPerSlice;
+  size_t m_nHashes;
+  /// slice i occupies words [i*m_nWordsPerSlice, (i+1)*m_nWordsPerSlice)
+  std::vector<uint64_t> m_bits;
+  /// number of hashes added to each slice
+  std::vector<size_t> m_counts;
+  size_t m_current = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
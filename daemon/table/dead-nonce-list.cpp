@@ -43,6 +43,18 @@ const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = 1 << 6;
 
+std::ostream&
+operator<<(std::ostream& os, DeadNonceListType type)
+{
+  switch (type) {
+    case DeadNonceListType::EXACT:
+      return os << "exact";
+    case DeadNonceListType::FILTER:
+      return os << "filter";
+  }
+  return os << static_cast<int>(type);
+}
+
 DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
   : m_lifetime(lifetime)
   , m_queue(m_index.get<0>())
@@ -55,18 +67,14 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
     NDN_THROW(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
-  for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
-  }
-
-  m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
-  m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+  this->startExact();
 }
 
 DeadNonceList::~DeadNonceList()
 {
   m_markEvent.cancel();
   m_adjustCapacityEvent.cancel();
+  m_rotateEvent.cancel();
 
   BOOST_ASSERT_MSG(DEFAULT_LIFETIME >= MIN_LIFETIME, "DEFAULT_LIFETIME is too small");
   static_assert(INITIAL_CAPACITY >= MIN_CAPACITY, "INITIAL_CAPACITY is too small");
@@ -83,6 +91,9 @@ DeadNonceList::~DeadNonceList()
 size_t
 DeadNonceList::size() const
 {
+  if (m_filter != nullptr) {
+    return m_filter->size();
+  }
   return m_queue.size() - this->countMarks();
 }
 
@@ -90,6 +101,9 @@ bool
 DeadNonceList::has(const Name& name, Interest::Nonce nonce) const
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
+  if (m_filter != nullptr) {
+    return m_filter->has(entry);
+  }
   return m_ht.find(entry) != m_ht.end();
 }
 
@@ -97,11 +111,70 @@ void
 DeadNonceList::add(const Name& name, Interest::Nonce nonce)
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
+  if (m_filter != nullptr) {
+    m_filter->add(entry);
+    return;
+  }
   m_queue.push_back(entry);
 
   this->evictEntries();
 }
 
+void
+DeadNonceList::setType(DeadNonceListType type, const DeadNonceFilter::Options& filterOptions)
+{
+  if (type == DeadNonceListType::EXACT) {
+    if (m_filter == nullptr) {
+      return;
+    }
+    NFD_LOG_DEBUG("setType exact");
+    m_rotateEvent.cancel();
+    m_filter.reset();
+    this->startExact();
+    return;
+  }
+
+  if (m_filter != nullptr &&
+      m_filter->getOptions().capacity == filterOptions.capacity &&
+      m_filter->getOptions().fpRate == filterOptions.fpRate &&
+      m_filter->getOptions().nSlices == filterOptions.nSlices) {
+    return;
+  }
+
+  auto filter = make_unique<DeadNonceFilter>(filterOptions);
+  NFD_LOG_DEBUG("setType filter capacity=" << filterOptions.capacity <<
+                " fpRate=" << filterOptions.fpRate << " bytes=" << filter->getNBytes());
+
+  if (m_filter == nullptr) {
+    for (Entry entry : m_queue) {
+      if (entry != MARK) {
+        filter->add(entry);
+      }
+    }
+    m_queue.clear();
+    m_actualMarkCounts.clear();
+    m_markEvent.cancel();
+    m_adjustCapacityEvent.cancel();
+  }
+
+  m_filter = std::move(filter);
+  m_rotateEvent.cancel();
+  m_rotateEvent = getScheduler().schedule(m_lifetime / (filterOptions.nSlices - 1),
+                                          [this] { rotateFilter(); });
+}
+
+size_t
+DeadNonceList::getNBytes() const
+{
+  if (m_filter != nullptr) {
+    return m_filter->getNBytes();
+  }
+  // each node of the index holds the entry, two links of the sequenced index,
+  // and one link of the hashed index; each bucket holds one link
+  return m_queue.size() * (sizeof(Entry) + 3 * sizeof(void*)) +
+         m_ht.bucket_count() * sizeof(void*);
+}
+
 DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, Interest::Nonce nonce)
 {
@@ -150,6 +223,29 @@ DeadNonceList::adjustCapacity()
   m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
+void
+DeadNonceList::startExact()
+{
+  m_queue.clear();
+  for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
+    m_queue.push_back(MARK);
+  }
+
+  m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
+  m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+}
+
+void
+DeadNonceList::rotateFilter()
+{
+  BOOST_ASSERT(m_filter != nullptr);
+  m_filter->rotate();
+  NFD_LOG_TRACE("rotateFilter size=" << m_filter->size());
+
+  m_rotateEvent = getScheduler().schedule(m_lifetime / (m_filter->getOptions().nSlices - 1),
+                                          [this] { rotateFilter(); });
+}
+
 void
 DeadNonceList::evictEntries()
 {
@@ -26,7 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
-#include "core/common.hpp"
+#include "dead-nonce-filter.hpp"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -34,6 +34,16 @@
 
 namespace nfd {
 
+/** \brief identifies a Dead Nonce List implementation
+ */
+enum class DeadNonceListType {
+  EXACT,  ///< hashes are kept in a container whose capacity follows the insertion rate
+  FILTER, ///< hashes are kept in a DeadNonceFilter of fixed size
+};
+
+std::ostream&
+operator<<(std::ostream& os, DeadNonceListType type);
+
 /** \brief Represents the Dead Nonce List
  *
  *  The Dead Nonce List is a global table that supplements PIT for loop detection.
@@ -50,6 +60,12 @@ namespace nfd {
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Alternatively, the hashes can be kept in a DeadNonceFilter, which uses a few octets per
+ *  entry and a fixed amount of memory, at the cost of a higher false positive rate that grows
+ *  if more Nonces than its capacity are added within the lifetime.
+ *  The filter is rotated at fixed intervals, so that every entry is kept for at least
+ *  the lifetime.
  */
 class DeadNonceList : noncopyable
 {
@@ -91,6 +107,39 @@ public:
     return m_lifetime;
   }
 
+  /** \return implementation in use
+   */
+  DeadNonceListType
+  getType() const
+  {
+    return m_filter == nullptr ? DeadNonceListType::EXACT : DeadNonceListType::FILTER;
+  }
+
+  /** \return options of the filter, or nullptr if the filter is not in use
+   */
+  const DeadNonceFilter::Options*
+  getFilterOptions() const
+  {
+    return m_filter == nullptr ? nullptr : &m_filter->getOptions();
+  }
+
+  /** \brief switch to another implementation
+   *  \param type the implementation
+   *  \param filterOptions options of the filter, used only if \p type is FILTER
+   *  \throw std::invalid_argument \p filterOptions are invalid
+   *
+   *  When switching from EXACT to FILTER, existing entries are added to the filter.
+   *  When switching from FILTER to EXACT, or when filter options are changed, existing entries
+   *  are forgotten. Nothing happens if the implementation and options are unchanged.
+   */
+  void
+  setType(DeadNonceListType type, const DeadNonceFilter::Options& filterOptions = {});
+
+  /** \return approximate number of octets used to store the entries
+   */
+  size_t
+  getNBytes() const;
+
 private: // Entry and Index
   typedef uint64_t Entry;
 
@@ -134,6 +183,17 @@ private: // actual lifetime estimation and capacity control
   void
   evictEntries();
 
+  /** \brief Reset the index to contain only the initial MARKs, and schedule mark() and
+   *         adjustCapacity()
+   */
+  void
+  startExact();
+
+  /** \brief Rotate the filter, so that entries older than the lifetime can be forgotten
+   */
+  void
+  rotateFilter();
+
 public:
   /// Default entry lifetime
   static const time::nanoseconds DEFAULT_LIFETIME;
@@ -206,6 +266,12 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity contr
 
   /// Maximum number of entries to evict at each operation if index is over capacity
   static const size_t EVICT_LIMIT;
+
+  // ---- filter
+
+  /// Filter in use, or nullptr if the index is in use
+  unique_ptr<DeadNonceFilter> m_filter;
+  scheduler::EventId m_rotateEvent;
 };
 
 } // namespace nfd
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FACE_INDEX_HPP
+#define NFD_DAEMON_TABLE_FACE_INDEX_HPP
+
+#include "face/face.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nfd {
+
+/** \brief An index from faces to the table entries that refer to them
+ *  \tparam E table entry type
+ *
+ *  This allows the entries of a face to be visited without enumerating the table,
+ *  e.g. when the face is removed. Faces are identified by address, so that faces
+ *  without a FaceId can be indexed as well.
+ */
+template<typename E>
+class FaceIndex : noncopyable
+{
+public:
+  /** \brief record that \p entry refers to \p face
+   *
+   *  Nothing happens if this has been recorded already.
+   */
+  void
+  insert(const Face& face, E& entry)
+  {
+    m_index[&face].insert(&entry);
+  }
+
+  /** \brief record that \p entry no longer refers to \p face
+   */
+  void
+  erase(const Face& face, E& entry)
+  {
+    auto it = m_index.find(&face);
+    if (it == m_index.end()) {
+      return;
+    }
+    it->second.erase(&entry);
+    if (it->second.empty()) {
+      m_index.erase(it);
+    }
+  }
+
+  /** \return entries that refer to \p face
+   *
+   *  The entries are returned in a copy, so that they can be modified while being visited.
+   */
+  std::vector<E*>
+  getEntries(const Face& face) const
+  {
+    auto it = m_index.find(&face);
+    if (it == m_index.end()) {
+      return {};
+    }
+    return {it->second.begin(), it->second.end()};
+  }
+
+  /** \return number of faces with at least one entry
+   */
+  size_t
+  getNFaces() const
+  {
+    return m_index.size();
+  }
+
+private:
+  std::unordered_map<const Face*, std::unordered_set<E*>> m_index;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FACE_INDEX_HPP
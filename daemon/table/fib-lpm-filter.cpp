@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-lpm-filter.hpp"
+
+namespace nfd {
+namespace fib {
+
+constexpr size_t LpmFilter::COUNTERS_PER_PREFIX;
+constexpr size_t LpmFilter::BLOCK_SIZE;
+constexpr uint8_t LpmFilter::MAX_COUNTER;
+
+LpmFilter::LpmFilter(size_t capacity)
+{
+  // at 16 counters per prefix and 2 counters per hash, the false positive rate is about 1.4%
+  size_t nCounters = BLOCK_SIZE;
+  while (nCounters < capacity * COUNTERS_PER_PREFIX) {
+    nCounters <<= 1;
+  }
+  m_counters.resize(nCounters);
+  m_nPrefixesByLength.fill(0);
+}
+
+std::pair<size_t, size_t>
+LpmFilter::getCounterIndexes(name_tree::HashValue h, size_t len) const
+{
+  // mix the length into the hash, then spread the bits (SplitMix64 finalizer)
+  uint64_t x = static_cast<uint64_t>(h) ^ (static_cast<uint64_t>(len + 1) * 0x9E3779B97F4A7C15);
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+  x ^= x >> 31;
+
+  // m_counters.size() is a power of two and a multiple of BLOCK_SIZE
+  size_t first = static_cast<size_t>(x & (m_counters.size() - 1));
+  size_t block = first & ~(BLOCK_SIZE - 1);
+  size_t second = block | static_cast<size_t>((x >> 32) & (BLOCK_SIZE - 1));
+  return {first, second};
+}
+
+bool
+LpmFilter::mayContain(name_tree::HashValue h, size_t len) const
+{
+  if (len > m_maxLength || m_nPrefixesByLength[len] == 0) {
+    return false;
+  }
+
+  size_t first, second;
+  std::tie(first, second) = getCounterIndexes(h, len);
+  return m_counters[first] > 0 && m_counters[second] > 0;
+}
+
+void
+LpmFilter::add(name_tree::HashValue h, size_t len)
+{
+  BOOST_ASSERT(len < m_nPrefixesByLength.size());
+
+  size_t first, second;
+  std::tie(first, second) = getCounterIndexes(h, len);
+  for (size_t i : {first, second}) {
+    if (m_counters[i] < MAX_COUNTER) {
+      ++m_counters[i];
+    }
+    if (first == second) {
+      break;
+    }
+  }
+
+  ++m_nPrefixesByLength[len];
+  m_maxLength = std::max(m_maxLength, len);
+  ++m_size;
+}
+
+void
+LpmFilter::remove(name_tree::HashValue h, size_t len)
+{
+  BOOST_ASSERT(len < m_nPrefixesByLength.size());
+  BOOST_ASSERT(m_nPrefixesByLength[len] > 0);
+
+  size_t first, second;
+  std::tie(first, second) = getCounterIndexes(h, len);
+  for (size_t i : {first, second}) {
+    BOOST_ASSERT(m_counters[i] > 0);
+    if (m_counters[i] < MAX_COUNTER) {
+      --m_counters[i];
+    }
+    if (first == second) {
+      break;
+    }
+  }
+
+  --m_nPrefixesByLength[len];
+  while (m_maxLength > 0 && m_nPrefixesByLength[m_maxLength] == 0) {
+    --m_maxLength;
+  }
+  --m_size;
+}
+
+} // namespace fib
+} // namespace nfd
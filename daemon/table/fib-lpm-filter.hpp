@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FIB_LPM_FILTER_HPP
+#define NFD_DAEMON_TABLE_FIB_LPM_FILTER_HPP
+
+#include "name-tree.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace fib {
+
+/** \brief A guide for FIB longest prefix match that avoids NameTree probes
+ *
+ *  LpmFilter remembers the name hash (as computed by name_tree::computeHash) and the length
+ *  of every FIB prefix. A longest prefix match consults the filter for each prefix length of
+ *  the name, and probes the NameTree only where the filter reports a possible FIB entry.
+ *  Lengths longer than the longest FIB prefix are not considered at all.
+ *
+ *  The filter is a counting Bloom filter, so that prefixes can be removed. Both counters of a
+ *  prefix are in the same 64-octet block, so that a test touches one cache line. It may report
+ *  false positives, but never false negatives.
+ */
+class LpmFilter : noncopyable
+{
+public:
+  /** \param capacity number of prefixes the filter is sized for
+   */
+  explicit
+  LpmFilter(size_t capacity = 0);
+
+  /** \brief determine whether a FIB prefix of length \p len with hash \p h may exist
+   */
+  bool
+  mayContain(name_tree::HashValue h, size_t len) const;
+
+  /** \pre len <= NameTree::getMaxDepth()
+   */
+  void
+  add(name_tree::HashValue h, size_t len);
+
+  /** \pre the prefix has been added
+   */
+  void
+  remove(name_tree::HashValue h, size_t len);
+
+  /** \return number of prefixes in the filter
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \return number of prefixes the filter is sized for
+   *
+   *  The false positive rate is about 1.4% up to this many prefixes, and increases beyond that.
+   */
+  size_t
+  getCapacity() const
+  {
+    return m_counters.size() / COUNTERS_PER_PREFIX;
+  }
+
+  /** \return length of the longest prefix in the filter, or 0 if there is none
+   */
+  size_t
+  getMaxLength() const
+  {
+    return m_maxLength;
+  }
+
+private:
+  std::pair<size_t, size_t>
+  getCounterIndexes(name_tree::HashValue h, size_t len) const;
+
+private:
+  static constexpr size_t COUNTERS_PER_PREFIX = 16;
+  static constexpr size_t BLOCK_SIZE = 64;
+  static constexpr uint8_t MAX_COUNTER = std::numeric_limits<uint8_t>::max();
+
+  /// counters; a counter that has reached MAX_COUNTER is never decremented
+  std::vector<uint8_t> m_counters;
+  /// number of prefixes of each length
+  std::array<size_t, NameTree::getMaxDepth() + 1> m_nPrefixesByLength;
+  size_t m_maxLength = 0;
+  size_t m_size = 0;
+};
+
+} // namespace fib
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FIB_LPM_FILTER_HPP
@@ -58,9 +58,32 @@ Fib::findLongestPrefixMatchImpl(const K& key) const
   return *s_emptyEntry;
 }
 
+const Entry&
+Fib::findLongestPrefixMatchFiltered(const Name& prefix) const
+{
+  BOOST_ASSERT(m_lpmFilter != nullptr);
+
+  size_t depth = std::min(prefix.size(), m_lpmFilter->getMaxLength());
+  name_tree::HashSequence hashes = name_tree::computeHashes(prefix, depth);
+
+  for (ssize_t i = depth; i >= 0; --i) {
+    if (!m_lpmFilter->mayContain(hashes[i], i)) {
+      continue;
+    }
+    name_tree::Entry* nte = m_nameTree.findExactMatch(prefix, i, hashes);
+    if (nte != nullptr && nte->getFibEntry() != nullptr) {
+      return *nte->getFibEntry();
+    }
+  }
+  return *s_emptyEntry;
+}
+
 const Entry&
 Fib::findLongestPrefixMatch(const Name& prefix) const
 {
+  if (m_lpmFilter != nullptr) {
+    return this->findLongestPrefixMatchFiltered(prefix);
+  }
   return this->findLongestPrefixMatchImpl(prefix);
 }
 
@@ -86,6 +109,27 @@ Fib::findExactMatch(const Name& prefix)
   return nullptr;
 }
 
+void
+Fib::setLpmFilterEnabled(bool wantEnabled)
+{
+  if (!wantEnabled) {
+    m_lpmFilter.reset();
+  }
+  else if (m_lpmFilter == nullptr) {
+    this->rebuildLpmFilter(m_nItems);
+  }
+}
+
+void
+Fib::rebuildLpmFilter(size_t capacity)
+{
+  auto filter = make_unique<LpmFilter>(capacity);
+  for (const Entry& entry : *this) {
+    filter->add(name_tree::computeHash(entry.getPrefix()), entry.getPrefix().size());
+  }
+  m_lpmFilter = std::move(filter);
+}
+
 std::pair<Entry*, bool>
 Fib::insert(const Name& prefix)
 {
@@ -97,6 +141,16 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+
+  if (m_lpmFilter != nullptr) {
+    if (m_lpmFilter->size() < m_lpmFilter->getCapacity()) {
+      m_lpmFilter->add(name_tree::computeHash(prefix), prefix.size());
+    }
+    else {
+      // the new entry is already in the NameTree, so the rebuilt filter includes it
+      this->rebuildLpmFilter(m_nItems * 2);
+    }
+  }
   return {nte.getFibEntry(), true};
 }
 
@@ -105,6 +159,14 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  Entry* entry = nte->getFibEntry();
+  for (const NextHop& nexthop : entry->getNextHops()) {
+    m_faceIndex.erase(nexthop.getFace(), *entry);
+  }
+  if (m_lpmFilter != nullptr) {
+    m_lpmFilter->remove(name_tree::computeHash(entry->getPrefix()), entry->getPrefix().size());
+  }
+
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -139,8 +201,10 @@ Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
   bool isNew;
   std::tie(it, isNew) = entry.addOrUpdateNextHop(face, cost);
 
-  if (isNew)
+  if (isNew) {
+    m_faceIndex.insert(face, entry);
     this->afterNewNextHop(entry.getPrefix(), *it);
+  }
 }
 
 Fib::RemoveNextHopResult
@@ -151,7 +215,9 @@ Fib::removeNextHop(Entry& entry, const Face& face)
   if (!isRemoved) {
     return RemoveNextHopResult::NO_SUCH_NEXTHOP;
   }
-  else if (!entry.hasNextHops()) {
+
+  m_faceIndex.erase(face, entry);
+  if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
     this->erase(nte, false);
     return RemoveNextHopResult::FIB_ENTRY_REMOVED;
@@ -26,7 +26,9 @@
 #ifndef NFD_DAEMON_TABLE_FIB_HPP
 #define NFD_DAEMON_TABLE_FIB_HPP
 
+#include "face-index.hpp"
 #include "fib-entry.hpp"
+#include "fib-lpm-filter.hpp"
 #include "name-tree.hpp"
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -58,6 +60,9 @@ public:
 
 public: // lookup
   /** \brief Performs a longest prefix match
+   *
+   *  If the LPM filter is enabled, only the prefix lengths that may have a FIB entry according
+   *  to the filter are looked up in the NameTree.
    */
   const Entry&
   findLongestPrefixMatch(const Name& prefix) const;
@@ -81,6 +86,23 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+public: // LPM filter
+  /** \brief Enable or disable the LPM filter
+   *
+   *  The filter is built from existing entries when enabled, and is kept up to date as entries
+   *  are inserted and erased. It grows as needed, rebuilding from all entries each time its
+   *  capacity doubles.
+   *  \sa LpmFilter
+   */
+  void
+  setLpmFilterEnabled(bool wantEnabled);
+
+  bool
+  isLpmFilterEnabled() const
+  {
+    return m_lpmFilter != nullptr;
+  }
+
 public: // mutation
   /** \brief Maximum number of components in a FIB entry prefix.
    */
@@ -121,6 +143,14 @@ public: // mutation
   RemoveNextHopResult
   removeNextHop(Entry& entry, const Face& face);
 
+  /** \return FIB entries that have a nexthop to \p face
+   */
+  std::vector<Entry*>
+  getEntriesByFace(const Face& face) const
+  {
+    return m_faceIndex.getEntries(face);
+  }
+
 public: // enumeration
   typedef boost::transformed_range<name_tree::GetTableEntry<Entry>, const name_tree::Range> Range;
   typedef boost::range_iterator<Range>::type const_iterator;
@@ -157,6 +187,14 @@ private:
   const Entry&
   findLongestPrefixMatchImpl(const K& key) const;
 
+  const Entry&
+  findLongestPrefixMatchFiltered(const Name& prefix) const;
+
+  /** \brief create an LPM filter for \p capacity prefixes, containing all existing entries
+   */
+  void
+  rebuildLpmFilter(size_t capacity);
+
   void
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
@@ -166,6 +204,10 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// FIB entries by nexthop face
+  FaceIndex<Entry> m_faceIndex;
+  /// LPM filter of all FIB prefixes, nullptr if disabled
+  unique_ptr<LpmFilter> m_lpmFilter;
 
   /** \brief The empty FIB entry.
    *
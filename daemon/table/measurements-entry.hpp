@@ -27,6 +27,7 @@
 #define NFD_DAEMON_TABLE_MEASUREMENTS_ENTRY_HPP
 
 #include "strategy-info-host.hpp"
+#include "common/timer-wheel.hpp"
 
 namespace nfd {
 
@@ -56,7 +57,7 @@ public:
 private:
   Name m_name;
   time::steady_clock::TimePoint m_expiry = time::steady_clock::TimePoint::min();
-  scheduler::EventId m_cleanup;
+  WheelTimer m_cleanup;
 
   name_tree::Entry* m_nameTreeEntry = nullptr;
 
@@ -32,6 +32,11 @@
 #include "table/strategy-choice-entry.hpp"
 
 namespace nfd {
+
+namespace fw {
+class Strategy;
+} // namespace fw
+
 namespace name_tree {
 
 class Node;
@@ -151,6 +156,27 @@ public: // attached table entries
   void
   setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceEntry);
 
+public: // effective strategy cache
+  /** \return the effective strategy cached by StrategyChoice,
+   *          or nullptr if the cache was not filled in \p generation
+   */
+  fw::Strategy*
+  getCachedStrategy(uint64_t generation) const
+  {
+    return m_cachedStrategyGeneration == generation ? m_cachedStrategy : nullptr;
+  }
+
+  /** \brief cache the effective strategy of this entry
+   *  \param generation StrategyChoice generation in which \p strategy is effective
+   *  \note This function is for StrategyChoice internal use.
+   */
+  void
+  setCachedStrategy(fw::Strategy& strategy, uint64_t generation) const
+  {
+    m_cachedStrategy = &strategy;
+    m_cachedStrategyGeneration = generation;
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    *  \note This function is for NameTree internal use. Other components
@@ -174,6 +200,9 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+  mutable fw::Strategy* m_cachedStrategy = nullptr;
+  mutable uint64_t m_cachedStrategyGeneration = 0;
+
   friend Node* getNode(const Entry& entry);
 };
 
@@ -27,6 +27,12 @@
 #include "common/city-hash.hpp"
 #include "common/logger.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NFD_HAVE_CRC32C_HASH
+#include <cstring>
+#include <nmmintrin.h>
+#endif
+
 namespace nfd {
 namespace name_tree {
 
@@ -56,24 +62,114 @@ public:
  */
 using HashFunc = std::conditional<(sizeof(HashValue) > 4), Hash64, Hash32>::type;
 
+#ifdef NFD_HAVE_CRC32C_HASH
+/** \brief computes hash value from a raw buffer with the SSE4.2 CRC32C instruction
+ *
+ *  Two CRC32C lanes process 8 octets per instruction each. The second lane sees the input
+ *  multiplied by an odd constant, so that the two halves of the hash value are not linearly
+ *  related, and a final mixing step spreads entropy into the low bits used as bucket index.
+ */
+__attribute__((target("sse4.2")))
+static HashValue
+computeCrc32cHash(const uint8_t* buffer, size_t length)
+{
+  static_assert(sizeof(HashValue) == 8, "");
+  const uint64_t k = 0x9e3779b97f4a7c15;
+
+  uint64_t h1 = length;
+  uint64_t h2 = ~length;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t v;
+    std::memcpy(&v, buffer + i, 8);
+    h1 = _mm_crc32_u64(h1, v);
+    h2 = _mm_crc32_u64(h2, v * k);
+  }
+  if (i < length) {
+    uint64_t v = 0;
+    std::memcpy(&v, buffer + i, length - i);
+    h1 = _mm_crc32_u64(h1, v);
+    h2 = _mm_crc32_u64(h2, v * k);
+  }
+
+  uint64_t h = (h1 << 32) | h2;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccd;
+  h ^= h >> 33;
+  return static_cast<HashValue>(h);
+}
+#endif // NFD_HAVE_CRC32C_HASH
+
+static HashValue
+computeCityHash(const uint8_t* buffer, size_t length)
+{
+  return HashFunc::compute(buffer, length);
+}
+
+using ComponentHashFunc = HashValue (*)(const uint8_t* buffer, size_t length);
+
+/** \return the fastest component hash function supported by the CPU
+ */
+static ComponentHashFunc
+selectComponentHashFunc()
+{
+#ifdef NFD_HAVE_CRC32C_HASH
+  if (__builtin_cpu_supports("sse4.2")) {
+    return &computeCrc32cHash;
+  }
+#endif // NFD_HAVE_CRC32C_HASH
+  return &computeCityHash;
+}
+
+static ComponentHashFunc
+getComponentHashFunc()
+{
+  static const ComponentHashFunc func = selectComponentHashFunc();
+  return func;
+}
+
+bool
+hasAcceleratedHash()
+{
+  return getComponentHashFunc() != &computeCityHash;
+}
+
+/** \brief invoke \p f with the hash value of each of the first \p prefixLen components of \p name
+ *
+ *  Components are located by walking the TLV wire encoding of the name once.
+ */
+template<typename F>
+static void
+foreachComponentHash(const Name& name, size_t prefixLen, const F& f)
+{
+  const ComponentHashFunc hashComponent = getComponentHashFunc();
+  const Block& wire = name.wireEncode(); // ensure wire buffer exists
+  auto pos = wire.value_begin();
+  auto end = wire.value_end();
+
+  for (size_t i = 0; i < prefixLen && pos != end; ++i) {
+    auto compBegin = pos;
+    uint32_t type = 0;
+    uint64_t length = 0;
+    BOOST_VERIFY(tlv::readType(pos, end, type) && tlv::readVarNumber(pos, end, length));
+    pos += length;
+    f(hashComponent(&*compBegin, static_cast<size_t>(pos - compBegin)));
+  }
+}
+
 HashValue
 computeHash(const Name& name, size_t prefixLen)
 {
-  name.wireEncode(); // ensure wire buffer exists
-
   HashValue h = 0;
-  for (size_t i = 0, last = std::min(prefixLen, name.size()); i < last; ++i) {
-    const name::Component& comp = name[i];
-    h ^= HashFunc::compute(comp.wire(), comp.size());
-  }
+  foreachComponentHash(name, prefixLen, [&h] (HashValue componentHash) {
+    h ^= componentHash;
+  });
   return h;
 }
 
 HashSequence
 computeHashes(const Name& name, size_t prefixLen)
 {
-  name.wireEncode(); // ensure wire buffer exists
-
   size_t last = std::min(prefixLen, name.size());
   HashSequence seq;
   seq.reserve(last + 1);
@@ -81,11 +177,10 @@ computeHashes(const Name& name, size_t prefixLen)
   HashValue h = 0;
   seq.push_back(h);
 
-  for (size_t i = 0; i < last; ++i) {
-    const name::Component& comp = name[i];
-    h ^= HashFunc::compute(comp.wire(), comp.size());
+  foreachComponentHash(name, last, [&] (HashValue componentHash) {
+    h ^= componentHash;
     seq.push_back(h);
-  }
+  });
   return seq;
 }
 
@@ -115,9 +210,90 @@ HashtableOptions::HashtableOptions(size_t size)
 {
 }
 
+std::ostream&
+operator<<(std::ostream& os, HashtableType type)
+{
+  switch (type) {
+    case HashtableType::CHAINED:
+      return os << "chained";
+    case HashtableType::OPEN_ADDRESSING:
+      return os << "open-addressing";
+  }
+  return os << static_cast<int>(type);
+}
+
+const Node*
+HashtableBase::find(const Name& name, size_t prefixLen) const
+{
+  HashValue h = computeHash(name, prefixLen);
+  return const_cast<HashtableBase*>(this)->findOrInsert(name, prefixLen, h, false).first;
+}
+
+const Node*
+HashtableBase::find(const Name& name, size_t prefixLen, const HashSequence& hashes) const
+{
+  BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
+  return const_cast<HashtableBase*>(this)->findOrInsert(name, prefixLen, hashes[prefixLen], false).first;
+}
+
+std::pair<const Node*, bool>
+HashtableBase::insert(const Name& name, size_t prefixLen, const HashSequence& hashes)
+{
+  BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
+  return this->findOrInsert(name, prefixLen, hashes[prefixLen], true);
+}
+
+std::pair<const Node*, bool>
+HashtableBase::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
+{
+  switch (m_type) {
+    case HashtableType::CHAINED:
+      return static_cast<Hashtable*>(this)->findOrInsert(name, prefixLen, h, allowInsert);
+    case HashtableType::OPEN_ADDRESSING:
+      return static_cast<OpenHashtable*>(this)->findOrInsert(name, prefixLen, h, allowInsert);
+  }
+  NDN_CXX_UNREACHABLE;
+}
+
+void
+HashtableBase::prefetchBucket(HashValue h) const
+{
+  switch (m_type) {
+    case HashtableType::CHAINED:
+      return static_cast<const Hashtable*>(this)->prefetchBucket(h);
+    case HashtableType::OPEN_ADDRESSING:
+      return static_cast<const OpenHashtable*>(this)->prefetchBucket(h);
+  }
+  NDN_CXX_UNREACHABLE;
+}
+
+void
+HashtableBase::prefetchNode(HashValue h) const
+{
+  switch (m_type) {
+    case HashtableType::CHAINED:
+      return static_cast<const Hashtable*>(this)->prefetchNode(h);
+    case HashtableType::OPEN_ADDRESSING:
+      return static_cast<const OpenHashtable*>(this)->prefetchNode(h);
+  }
+  NDN_CXX_UNREACHABLE;
+}
+
+unique_ptr<HashtableBase>
+makeHashtable(HashtableType type, const HashtableOptions& options)
+{
+  switch (type) {
+    case HashtableType::CHAINED:
+      return make_unique<Hashtable>(options);
+    case HashtableType::OPEN_ADDRESSING:
+      return make_unique<OpenHashtable>(options);
+  }
+  NDN_CXX_UNREACHABLE;
+}
+
 Hashtable::Hashtable(const Options& options)
-  : m_options(options)
-  , m_size(0)
+  : HashtableBase(HashtableType::CHAINED)
+  , m_options(options)
 {
   BOOST_ASSERT(m_options.minSize > 0);
   BOOST_ASSERT(m_options.initialSize >= m_options.minSize);
@@ -199,32 +375,29 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
   NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " bucket=" << bucket);
   ++m_size;
 
-  if (m_size > m_expandThreshold) {
-    this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
-  }
-
+  this->expandIfNeeded();
   return {node, true};
 }
 
-const Node*
-Hashtable::find(const Name& name, size_t prefixLen) const
-{
-  HashValue h = computeHash(name, prefixLen);
-  return const_cast<Hashtable*>(this)->findOrInsert(name, prefixLen, h, false).first;
-}
-
-const Node*
-Hashtable::find(const Name& name, size_t prefixLen, const HashSequence& hashes) const
+void
+Hashtable::prefetchNode(HashValue h) const
 {
-  BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
-  return const_cast<Hashtable*>(this)->findOrInsert(name, prefixLen, hashes[prefixLen], false).first;
+  for (const Node* node = m_buckets[this->computeBucketIndex(h)]; node != nullptr; node = node->next) {
+    if (node->hash == h) {
+      // the lookup compares the name next
+      __builtin_prefetch(node);
+      __builtin_prefetch(&node->entry.getName());
+      return;
+    }
+  }
 }
 
-std::pair<const Node*, bool>
-Hashtable::insert(const Name& name, size_t prefixLen, const HashSequence& hashes)
+void
+Hashtable::expandIfNeeded()
 {
-  BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
-  return this->findOrInsert(name, prefixLen, hashes[prefixLen], true);
+  if (m_size > m_expandThreshold) {
+    this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
+  }
 }
 
 void
@@ -247,6 +420,55 @@ Hashtable::erase(Node* node)
   }
 }
 
+const Node*
+Hashtable::getFirstNode() const
+{
+  for (const Node* head : m_buckets) {
+    if (head != nullptr) {
+      return head;
+    }
+  }
+  return nullptr;
+}
+
+const Node*
+Hashtable::getNextNode(const Node* node) const
+{
+  if (node->next != nullptr) {
+    return node->next;
+  }
+
+  for (size_t bucket = this->computeBucketIndex(node->hash) + 1; bucket < m_buckets.size(); ++bucket) {
+    if (m_buckets[bucket] != nullptr) {
+      return m_buckets[bucket];
+    }
+  }
+  return nullptr;
+}
+
+std::vector<Node*>
+Hashtable::releaseNodes()
+{
+  std::vector<Node*> nodes;
+  nodes.reserve(m_size);
+  for (size_t bucket = 0; bucket < m_buckets.size(); ++bucket) {
+    foreachNode(m_buckets[bucket], [&] (Node* node) {
+      this->detach(bucket, node);
+      nodes.push_back(node);
+    });
+  }
+  m_size = 0;
+  return nodes;
+}
+
+void
+Hashtable::adoptNode(Node* node)
+{
+  this->attach(this->computeBucketIndex(node->hash), node);
+  ++m_size;
+  this->expandIfNeeded();
+}
+
 void
 Hashtable::computeThresholds()
 {
@@ -277,5 +499,297 @@ Hashtable::resize(size_t newNBuckets)
   this->computeThresholds();
 }
 
+static size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t result = 2;
+  while (result < n) {
+    result <<= 1;
+  }
+  return result;
+}
+
+constexpr size_t OpenHashtable::MIGRATION_STEP;
+
+OpenHashtable::OpenHashtable(const Options& options)
+  : HashtableBase(HashtableType::OPEN_ADDRESSING)
+  , m_options(options)
+{
+  BOOST_ASSERT(m_options.minSize > 0);
+  BOOST_ASSERT(m_options.initialSize >= m_options.minSize);
+  BOOST_ASSERT(m_options.expandLoadFactor > 0.0);
+  BOOST_ASSERT(m_options.expandLoadFactor < 1.0);
+  BOOST_ASSERT(m_options.shrinkLoadFactor >= 0.0);
+  BOOST_ASSERT(m_options.shrinkLoadFactor < m_options.expandLoadFactor / 2);
+
+  m_options.minSize = roundUpToPowerOfTwo(m_options.minSize);
+  this->startResize(roundUpToPowerOfTwo(m_options.initialSize));
+}
+
+OpenHashtable::~OpenHashtable()
+{
+  Node* node = m_head;
+  while (node != nullptr) {
+    Node* next = node->next;
+    node->prev = node->next = nullptr;
+    delete node;
+    node = next;
+  }
+}
+
+size_t
+OpenHashtable::findSlot(const Slots& slots, const Name& name, size_t prefixLen, HashValue h)
+{
+  size_t mask = slots.size() - 1;
+  for (size_t i = h & mask, distance = 0; slots[i].node != nullptr; i = (i + 1) & mask, ++distance) {
+    // with Robin Hood probing, a node with this hash would have displaced a closer node
+    if (getProbeDistance(slots, i) < distance) {
+      break;
+    }
+    if (slots[i].hash == h && name.compare(0, prefixLen, slots[i].node->entry.getName()) == 0) {
+      return i;
+    }
+  }
+  return slots.size();
+}
+
+size_t
+OpenHashtable::findSlot(const Slots& slots, const Node* node)
+{
+  size_t mask = slots.size() - 1;
+  for (size_t i = node->hash & mask, distance = 0; slots[i].node != nullptr; i = (i + 1) & mask, ++distance) {
+    if (getProbeDistance(slots, i) < distance) {
+      break;
+    }
+    if (slots[i].node == node) {
+      return i;
+    }
+  }
+  return slots.size();
+}
+
+void
+OpenHashtable::insertSlot(Slots& slots, Slot slot)
+{
+  size_t mask = slots.size() - 1;
+  for (size_t i = slot.hash & mask, distance = 0; ; i = (i + 1) & mask, ++distance) {
+    if (slots[i].node == nullptr) {
+      slots[i] = slot;
+      return;
+    }
+    size_t existingDistance = getProbeDistance(slots, i);
+    if (existingDistance < distance) {
+      std::swap(slots[i], slot);
+      distance = existingDistance;
+    }
+  }
+}
+
+void
+OpenHashtable::eraseSlot(Slots& slots, size_t i)
+{
+  size_t mask = slots.size() - 1;
+  for (size_t next = (i + 1) & mask;
+       slots[next].node != nullptr && getProbeDistance(slots, next) > 0;
+       i = next, next = (next + 1) & mask) {
+    slots[i] = slots[next];
+  }
+  slots[i] = {0, nullptr};
+}
+
+std::pair<const Node*, bool>
+OpenHashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
+{
+  size_t i = findSlot(m_slots, name, prefixLen, h);
+  if (i < m_slots.size()) {
+    NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " slot=" << i);
+    return {m_slots[i].node, false};
+  }
+
+  if (this->isMigrating()) {
+    i = findSlot(m_oldSlots, name, prefixLen, h);
+    if (i < m_oldSlots.size()) {
+      NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " old-slot=" << i);
+      return {m_oldSlots[i].node, false};
+    }
+  }
+
+  if (!allowInsert) {
+    NFD_LOG_TRACE("not-found " << name.getPrefix(prefixLen) << " hash=" << h);
+    return {nullptr, false};
+  }
+
+  Node* node = new Node(h, name.getPrefix(prefixLen));
+  NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h);
+  this->adoptNode(node);
+  return {node, true};
+}
+
+void
+OpenHashtable::prefetchNode(HashValue h) const
+{
+  prefetchNode(m_slots, h);
+  if (this->isMigrating()) {
+    prefetchNode(m_oldSlots, h);
+  }
+}
+
+void
+OpenHashtable::prefetchNode(const Slots& slots, HashValue h)
+{
+  size_t mask = slots.size() - 1;
+  for (size_t i = h & mask, distance = 0; slots[i].node != nullptr; i = (i + 1) & mask, ++distance) {
+    if (getProbeDistance(slots, i) < distance) {
+      break;
+    }
+    if (slots[i].hash == h) {
+      __builtin_prefetch(slots[i].node);
+      __builtin_prefetch(&slots[i].node->entry.getName());
+      return;
+    }
+  }
+}
+
+void
+OpenHashtable::adoptNode(Node* node)
+{
+  insertSlot(m_slots, {node->hash, node});
+  this->link(node);
+  ++m_size;
+
+  this->migrate(MIGRATION_STEP);
+  this->resizeIfNeeded();
+}
+
+void
+OpenHashtable::erase(Node* node)
+{
+  BOOST_ASSERT(node != nullptr);
+  BOOST_ASSERT(node->entry.getParent() == nullptr);
+  NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash);
+
+  size_t i = findSlot(m_slots, node);
+  if (i < m_slots.size()) {
+    eraseSlot(m_slots, i);
+  }
+  else {
+    BOOST_ASSERT(this->isMigrating());
+    i = findSlot(m_oldSlots, node);
+    BOOST_ASSERT(i < m_oldSlots.size());
+    eraseSlot(m_oldSlots, i);
+  }
+
+  this->unlink(node);
+  delete node;
+  --m_size;
+
+  this->migrate(MIGRATION_STEP);
+  this->resizeIfNeeded();
+}
+
+std::vector<Node*>
+OpenHashtable::releaseNodes()
+{
+  std::vector<Node*> nodes;
+  nodes.reserve(m_size);
+  while (m_head != nullptr) {
+    Node* node = m_head;
+    this->unlink(node);
+    nodes.push_back(node);
+  }
+
+  std::fill(m_slots.begin(), m_slots.end(), Slot{0, nullptr});
+  Slots().swap(m_oldSlots);
+  m_size = 0;
+  return nodes;
+}
+
+void
+OpenHashtable::link(Node* node)
+{
+  BOOST_ASSERT(node->prev == nullptr);
+  BOOST_ASSERT(node->next == nullptr);
+
+  node->next = m_head;
+  if (m_head != nullptr) {
+    m_head->prev = node;
+  }
+  m_head = node;
+}
+
+void
+OpenHashtable::unlink(Node* node)
+{
+  if (node->prev != nullptr) {
+    node->prev->next = node->next;
+  }
+  else {
+    BOOST_ASSERT(m_head == node);
+    m_head = node->next;
+  }
+
+  if (node->next != nullptr) {
+    node->next->prev = node->prev;
+  }
+
+  node->prev = node->next = nullptr;
+}
+
+void
+OpenHashtable::resizeIfNeeded()
+{
+  if (m_size > m_expandThreshold) {
+    this->startResize(m_slots.size() * 2);
+  }
+  else if (m_size < m_shrinkThreshold && m_slots.size() > m_options.minSize) {
+    this->startResize(m_slots.size() / 2);
+  }
+}
+
+void
+OpenHashtable::startResize(size_t newNSlots)
+{
+  NFD_LOG_DEBUG("resize from=" << m_slots.size() << " to=" << newNSlots);
+
+  // an earlier migration must be complete before another one starts,
+  // which is normally the case already (see MIGRATION_STEP)
+  this->migrate(std::numeric_limits<size_t>::max());
+
+  m_oldSlots.swap(m_slots);
+  m_slots.assign(newNSlots, Slot{0, nullptr});
+  m_migratePos = 0;
+  if (m_size == 0) {
+    Slots().swap(m_oldSlots);
+  }
+
+  m_expandThreshold = static_cast<size_t>(m_options.expandLoadFactor * newNSlots);
+  m_shrinkThreshold = static_cast<size_t>(m_options.shrinkLoadFactor * newNSlots);
+  NFD_LOG_TRACE("thresholds expand=" << m_expandThreshold << " shrink=" << m_shrinkThreshold);
+}
+
+void
+OpenHashtable::migrate(size_t nSteps)
+{
+  if (!this->isMigrating()) {
+    return;
+  }
+
+  // Slots before m_migratePos are empty. Moving a node out of the old slot array shifts
+  // subsequent slots backward, so the same position is examined again.
+  for (size_t step = 0; step < nSteps && m_migratePos < m_oldSlots.size(); ++step) {
+    if (m_oldSlots[m_migratePos].node == nullptr) {
+      ++m_migratePos;
+      continue;
+    }
+    insertSlot(m_slots, m_oldSlots[m_migratePos]);
+    eraseSlot(m_oldSlots, m_migratePos);
+  }
+
+  if (m_migratePos == m_oldSlots.size()) {
+    NFD_LOG_TRACE("migration complete");
+    Slots().swap(m_oldSlots);
+  }
+}
+
 } // namespace name_tree
 } // namespace nfd
@@ -43,20 +43,32 @@ using HashValue = size_t;
 using HashSequence = std::vector<HashValue>;
 
 /** \brief computes hash value of \p name.getPrefix(prefixLen)
+ *
+ *  The hash value is the XOR of the hash values of the TLV encoding of each name component.
+ *  Components are hashed with the SSE4.2 CRC32C instruction if the CPU supports it,
+ *  and with CityHash otherwise.
  */
 HashValue
 computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
 /** \brief computes hash values for each prefix of \p name.getPrefix(prefixLen)
  *  \return a hash sequence, where the i-th hash value equals computeHash(name, i)
+ *
+ *  All hash values are computed in one pass over the TLV encoding of the name.
  */
 HashSequence
 computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
+/** \return whether computeHash and computeHashes use a hardware-accelerated hash function
+ */
+bool
+hasAcceleratedHash();
+
 /** \brief a hashtable node
  *
- *  Zero or more nodes can be added to a hashtable bucket. They are organized as
+ *  In Hashtable, zero or more nodes can be added to a hashtable bucket. They are organized as
  *  a doubly linked list through prev and next pointers.
+ *  In OpenHashtable, all nodes are organized as one doubly linked list through these pointers.
  */
 class Node : noncopyable
 {
@@ -139,24 +151,39 @@ public:
   float shrinkFactor = 0.5;
 };
 
+/** \brief identifies a hashtable implementation
+ */
+enum class HashtableType {
+  CHAINED,         ///< Hashtable
+  OPEN_ADDRESSING, ///< OpenHashtable
+};
+
+std::ostream&
+operator<<(std::ostream& os, HashtableType type);
+
 /** \brief a hashtable for fast exact name lookup
  *
- *  The Hashtable contains a number of buckets.
- *  Each node is placed into a bucket determined by a hash value computed from its name.
- *  Hash collision is resolved through a doubly linked list in each bucket.
- *  The number of buckets is adjusted according to how many nodes are stored.
+ *  This is the interface used by NameTree. A hashtable owns its nodes.
+ *
+ *  Lookups and insertions, which NameTree performs for every prefix of every packet name,
+ *  are dispatched to the implementation with a branch on getType() instead of a virtual call,
+ *  so that the implementation can be inlined. Other operations are virtual.
  */
-class Hashtable
+class HashtableBase : noncopyable
 {
 public:
   typedef HashtableOptions Options;
 
-  explicit
-  Hashtable(const Options& options);
+  virtual
+  ~HashtableBase() = default;
 
-  /** \brief deallocates all nodes
+  /** \return the implementation of this hashtable
    */
-  ~Hashtable();
+  HashtableType
+  getType() const
+  {
+    return m_type;
+  }
 
   /** \return number of nodes
    */
@@ -166,10 +193,123 @@ public:
     return m_size;
   }
 
+  /** \return number of buckets
+   */
+  virtual size_t
+  getNBuckets() const = 0;
+
+  /** \brief find node for name.getPrefix(prefixLen)
+   *  \pre name.size() > prefixLen
+   */
+  const Node*
+  find(const Name& name, size_t prefixLen) const;
+
+  /** \brief find node for name.getPrefix(prefixLen)
+   *  \pre name.size() > prefixLen
+   *  \pre hashes == computeHashes(name)
+   */
+  const Node*
+  find(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+
+  /** \brief find or insert node for name.getPrefix(prefixLen)
+   *  \pre name.size() > prefixLen
+   *  \pre hashes == computeHashes(name)
+   */
+  std::pair<const Node*, bool>
+  insert(const Name& name, size_t prefixLen, const HashSequence& hashes);
+
+  /** \brief hint that the bucket of hash value \p h is about to be accessed
+   *
+   *  This issues a software prefetch of the bucket of \p h, and has no other effect.
+   *  Calling prefetchNode for the same hash value some time later lets the bucket arrive first.
+   */
+  void
+  prefetchBucket(HashValue h) const;
+
+  /** \brief hint that the node with hash value \p h is about to be looked up
+   *
+   *  This reads the bucket of \p h and issues a software prefetch of the first node in it
+   *  with hash value \p h, if any, and has no other effect.
+   */
+  void
+  prefetchNode(HashValue h) const;
+
+  /** \brief delete node
+   *  \pre node exists in this hashtable
+   */
+  virtual void
+  erase(Node* node) = 0;
+
+  /** \return the first node in an implementation-defined order, or nullptr if empty
+   */
+  virtual const Node*
+  getFirstNode() const = 0;
+
+  /** \return the node after \p node in the order of getFirstNode(), or nullptr if none
+   */
+  virtual const Node*
+  getNextNode(const Node* node) const = 0;
+
+  /** \brief remove all nodes without deallocating them
+   *  \return the removed nodes; the caller takes ownership
+   */
+  virtual std::vector<Node*>
+  releaseNodes() = 0;
+
+  /** \brief add a node released from another hashtable
+   *  \pre no node with the same name exists in this hashtable
+   */
+  virtual void
+  adoptNode(Node* node) = 0;
+
+protected:
+  /** \pre this is an instance of the class identified by \p type
+   */
+  explicit
+  HashtableBase(HashtableType type)
+    : m_type(type)
+  {
+  }
+
+private:
+  /** \brief invoke findOrInsert of the implementation identified by m_type
+   */
+  std::pair<const Node*, bool>
+  findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
+
+private:
+  const HashtableType m_type;
+
+protected:
+  size_t m_size = 0;
+};
+
+/** \brief create a hashtable of the specified type
+ */
+unique_ptr<HashtableBase>
+makeHashtable(HashtableType type, const HashtableOptions& options);
+
+/** \brief a hashtable for fast exact name lookup
+ *
+ *  The Hashtable contains a number of buckets.
+ *  Each node is placed into a bucket determined by a hash value computed from its name.
+ *  Hash collision is resolved through a doubly linked list in each bucket.
+ *  The number of buckets is adjusted according to how many nodes are stored.
+ */
+class Hashtable final : public HashtableBase
+{
+public:
+  explicit
+  Hashtable(const Options& options);
+
+  /** \brief deallocates all nodes
+   */
+  ~Hashtable() final;
+
   /** \return number of buckets
    */
   size_t
-  getNBuckets() const
+  getNBuckets() const final
   {
     return m_buckets.size();
   }
@@ -192,31 +332,20 @@ public:
     return m_buckets[bucket]; // don't use m_bucket.at() for better performance
   }
 
-  /** \brief find node for name.getPrefix(prefixLen)
-   *  \pre name.size() > prefixLen
-   */
+  void
+  erase(Node* node) final;
+
   const Node*
-  find(const Name& name, size_t prefixLen) const;
+  getFirstNode() const final;
 
-  /** \brief find node for name.getPrefix(prefixLen)
-   *  \pre name.size() > prefixLen
-   *  \pre hashes == computeHashes(name)
-   */
   const Node*
-  find(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+  getNextNode(const Node* node) const final;
 
-  /** \brief find or insert node for name.getPrefix(prefixLen)
-   *  \pre name.size() > prefixLen
-   *  \pre hashes == computeHashes(name)
-   */
-  std::pair<const Node*, bool>
-  insert(const Name& name, size_t prefixLen, const HashSequence& hashes);
+  std::vector<Node*>
+  releaseNodes() final;
 
-  /** \brief delete node
-   *  \pre node exists in this hashtable
-   */
   void
-  erase(Node* node);
+  adoptNode(Node* node) final;
 
 private:
   /** \brief attach node to bucket
@@ -232,6 +361,20 @@ private:
   std::pair<const Node*, bool>
   findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
 
+  void
+  prefetchBucket(HashValue h) const
+  {
+    __builtin_prefetch(&m_buckets[this->computeBucketIndex(h)]);
+  }
+
+  void
+  prefetchNode(HashValue h) const;
+
+  /** \brief expand the hashtable if it has too many nodes
+   */
+  void
+  expandIfNeeded();
+
   void
   computeThresholds();
 
@@ -241,9 +384,155 @@ private:
 private:
   std::vector<Node*> m_buckets;
   Options m_options;
-  size_t m_size;
   size_t m_expandThreshold;
   size_t m_shrinkThreshold;
+
+  friend class HashtableBase;
+};
+
+/** \brief an open addressing hashtable for fast exact name lookup
+ *
+ *  Each slot stores the hash value of a node next to the node pointer, so that a lookup
+ *  examines consecutive slots and dereferences a node only if its full hash value matches.
+ *  Collisions are resolved with Robin Hood linear probing, and deletion shifts subsequent
+ *  slots backward, so that no tombstones are needed.
+ *
+ *  When the number of slots changes, nodes are migrated from the old slot array to the new
+ *  one a few slots at a time during subsequent insertions and deletions, instead of all at
+ *  once. Lookups consult both arrays while a migration is in progress.
+ *
+ *  The number of slots is a power of two; Options::expandFactor and Options::shrinkFactor
+ *  are treated as 2 and 0.5 respectively.
+ */
+class OpenHashtable final : public HashtableBase
+{
+public:
+  explicit
+  OpenHashtable(const Options& options);
+
+  /** \brief deallocates all nodes
+   */
+  ~OpenHashtable() final;
+
+  /** \return number of slots
+   */
+  size_t
+  getNBuckets() const final
+  {
+    return m_slots.size();
+  }
+
+  /** \return whether nodes are being migrated from an old slot array
+   */
+  bool
+  isMigrating() const
+  {
+    return !m_oldSlots.empty();
+  }
+
+  void
+  erase(Node* node) final;
+
+  const Node*
+  getFirstNode() const final
+  {
+    return m_head;
+  }
+
+  const Node*
+  getNextNode(const Node* node) const final
+  {
+    return node->next;
+  }
+
+  std::vector<Node*>
+  releaseNodes() final;
+
+  void
+  adoptNode(Node* node) final;
+
+public:
+  /** \brief number of old slots migrated, or skipped if empty, during each insertion or deletion
+   *
+   *  With the default load factors, the number of nodes has to change by at least 1/20 of the
+   *  old slot count before the next resize, so that a migration normally completes in time.
+   */
+  static constexpr size_t MIGRATION_STEP = 32;
+
+private:
+  struct Slot
+  {
+    HashValue hash;
+    Node* node; ///< nullptr if the slot is empty
+  };
+
+  using Slots = std::vector<Slot>;
+
+  static size_t
+  getProbeDistance(const Slots& slots, size_t i)
+  {
+    return (i - slots[i].hash) & (slots.size() - 1);
+  }
+
+  static size_t
+  findSlot(const Slots& slots, const Name& name, size_t prefixLen, HashValue h);
+
+  static size_t
+  findSlot(const Slots& slots, const Node* node);
+
+  static void
+  insertSlot(Slots& slots, Slot slot);
+
+  static void
+  eraseSlot(Slots& slots, size_t i);
+
+  std::pair<const Node*, bool>
+  findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
+
+  void
+  prefetchBucket(HashValue h) const
+  {
+    __builtin_prefetch(&m_slots[h & (m_slots.size() - 1)]);
+    if (this->isMigrating()) {
+      __builtin_prefetch(&m_oldSlots[h & (m_oldSlots.size() - 1)]);
+    }
+  }
+
+  void
+  prefetchNode(HashValue h) const;
+
+  /** \brief prefetch the first node in \p slots with hash value \p h, if any
+   */
+  static void
+  prefetchNode(const Slots& slots, HashValue h);
+
+  void
+  link(Node* node);
+
+  void
+  unlink(Node* node);
+
+  /** \brief start a resize if the number of nodes has crossed a threshold
+   */
+  void
+  resizeIfNeeded();
+
+  void
+  startResize(size_t newNSlots);
+
+  void
+  migrate(size_t nSteps);
+
+private:
+  Options m_options;
+  Slots m_slots;
+  Slots m_oldSlots;
+  size_t m_migratePos = 0;
+  Node* m_head = nullptr;
+  size_t m_expandThreshold;
+  size_t m_shrinkThreshold;
+
+  friend class HashtableBase;
 };
 
 } // namespace name_tree
@@ -153,7 +153,7 @@ public:
 
 protected:
   const NameTree& nt;
-  const Hashtable& ht;
+  const HashtableBase& ht;
 };
 
 /** \brief full enumeration implementation
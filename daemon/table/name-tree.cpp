@@ -35,11 +35,29 @@ namespace name_tree {
 
 NFD_LOG_INIT(NameTree);
 
-NameTree::NameTree(size_t nBuckets)
-  : m_ht(HashtableOptions(nBuckets))
+NameTree::NameTree(size_t nBuckets, HashtableType hashtableType)
+  : m_hashtableOptions(nBuckets)
+  , m_hashtableType(hashtableType)
+  , m_ht(makeHashtable(hashtableType, m_hashtableOptions))
 {
 }
 
+void
+NameTree::setHashtableType(HashtableType type)
+{
+  if (type == m_hashtableType) {
+    return;
+  }
+  NFD_LOG_DEBUG("setHashtableType " << m_hashtableType << " to " << type);
+
+  auto ht = makeHashtable(type, m_hashtableOptions);
+  for (Node* node : m_ht->releaseNodes()) {
+    ht->adoptNode(node);
+  }
+  m_ht = std::move(ht);
+  m_hashtableType = type;
+}
+
 Entry&
 NameTree::lookup(const Name& name, size_t prefixLen)
 {
@@ -47,13 +65,22 @@ NameTree::lookup(const Name& name, size_t prefixLen)
   BOOST_ASSERT(prefixLen <= name.size());
   BOOST_ASSERT(prefixLen <= getMaxDepth());
 
-  HashSequence hashes = computeHashes(name, prefixLen);
+  return this->lookup(name, prefixLen, computeHashes(name, prefixLen));
+}
+
+Entry&
+NameTree::lookup(const Name& name, size_t prefixLen, const HashSequence& hashes)
+{
+  BOOST_ASSERT(prefixLen <= name.size());
+  BOOST_ASSERT(prefixLen <= getMaxDepth());
+  BOOST_ASSERT(hashes.size() > prefixLen);
+
   const Node* node = nullptr;
   Entry* parent = nullptr;
 
   for (size_t i = 0; i <= prefixLen; ++i) {
     bool isNew = false;
-    std::tie(node, isNew) = m_ht.insert(name, i, hashes);
+    std::tie(node, isNew) = m_ht->insert(name, i, hashes);
 
     if (isNew && parent != nullptr) {
       node->entry.setParent(*parent);
@@ -132,7 +159,7 @@ NameTree::eraseIfEmpty(Entry* entry, bool canEraseAncestors)
       entry->unsetParent();
     }
 
-    m_ht.erase(getNode(*entry));
+    m_ht->erase(getNode(*entry));
     ++nErased;
 
     if (!canEraseAncestors) {
@@ -146,6 +173,22 @@ NameTree::eraseIfEmpty(Entry* entry, bool canEraseAncestors)
   return nErased;
 }
 
+void
+NameTree::prefetchBuckets(const HashSequence& hashes) const
+{
+  for (HashValue h : hashes) {
+    m_ht->prefetchBucket(h);
+  }
+}
+
+void
+NameTree::prefetchNodes(const HashSequence& hashes) const
+{
+  for (HashValue h : hashes) {
+    m_ht->prefetchNode(h);
+  }
+}
+
 Entry*
 NameTree::findExactMatch(const Name& name, size_t prefixLen) const
 {
@@ -154,7 +197,19 @@ NameTree::findExactMatch(const Name& name, size_t prefixLen) const
     return nullptr;
   }
 
-  const Node* node = m_ht.find(name, prefixLen);
+  const Node* node = m_ht->find(name, prefixLen);
+  return node == nullptr ? nullptr : &node->entry;
+}
+
+Entry*
+NameTree::findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const
+{
+  BOOST_ASSERT(prefixLen <= name.size());
+  if (prefixLen > getMaxDepth()) {
+    return nullptr;
+  }
+
+  const Node* node = m_ht->find(name, prefixLen, hashes);
   return node == nullptr ? nullptr : &node->entry;
 }
 
@@ -162,10 +217,18 @@ Entry*
 NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySelector) const
 {
   size_t depth = std::min(name.size(), getMaxDepth());
-  HashSequence hashes = computeHashes(name, depth);
+  return this->findLongestPrefixMatch(name, computeHashes(name, depth), entrySelector);
+}
+
+Entry*
+NameTree::findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                                 const EntrySelector& entrySelector) const
+{
+  size_t depth = std::min(name.size(), getMaxDepth());
+  BOOST_ASSERT(hashes.size() > depth);
 
   for (ssize_t i = depth; i >= 0; --i) {
-    const Node* node = m_ht.find(name, i, hashes);
+    const Node* node = m_ht->find(name, i, hashes);
     if (node != nullptr && entrySelector(node->entry)) {
       return &node->entry;
     }
@@ -222,6 +285,14 @@ NameTree::findAllMatches(const Name& name, const EntrySelector& entrySelector) c
   return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
 }
 
+boost::iterator_range<NameTree::const_iterator>
+NameTree::findAllMatches(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector) const
+{
+  Entry* entry = this->findLongestPrefixMatch(name, hashes, entrySelector);
+  return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
+}
+
 boost::iterator_range<NameTree::const_iterator>
 NameTree::fullEnumerate(const EntrySelector& entrySelector) const
 {
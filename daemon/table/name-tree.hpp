@@ -37,7 +37,7 @@ class NameTree : noncopyable
 {
 public:
   explicit
-  NameTree(size_t nBuckets = 1024);
+  NameTree(size_t nBuckets = 1024, HashtableType hashtableType = HashtableType::CHAINED);
 
 public: // information
   /** \brief Maximum depth of the name tree
@@ -58,7 +58,7 @@ public: // information
   size_t
   size() const
   {
-    return m_ht.size();
+    return m_ht->size();
   }
 
   /** \return number of hashtable buckets
@@ -66,9 +66,25 @@ public: // information
   size_t
   getNBuckets() const
   {
-    return m_ht.getNBuckets();
+    return m_ht->getNBuckets();
   }
 
+  /** \return hashtable implementation in use
+   */
+  HashtableType
+  getHashtableType() const
+  {
+    return m_hashtableType;
+  }
+
+  /** \brief switch to another hashtable implementation
+   *
+   *  Existing entries are moved to the new hashtable, and remain valid.
+   *  \warning Iterators are invalidated.
+   */
+  void
+  setHashtableType(HashtableType type);
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    */
@@ -92,6 +108,14 @@ public: // mutation
   Entry&
   lookup(const Name& name, size_t prefixLen);
 
+  /** \brief Find or insert an entry by name, with precomputed hash values
+   *
+   *  This is equivalent to `lookup(name, prefixLen)`, without hashing the name again.
+   *  \pre hashes[i] == computeHash(name, i) for every i <= prefixLen
+   */
+  Entry&
+  lookup(const Name& name, size_t prefixLen, const HashSequence& hashes);
+
   /** \brief Equivalent to `lookup(name, name.size())`
    */
   Entry&
@@ -142,12 +166,37 @@ public: // mutation
   eraseIfEmpty(Entry* entry, bool canEraseAncestors = true);
 
 public: // matching
+  /** \brief Hint that entries with the specified hash values are about to be looked up
+   *
+   *  This issues software prefetches of the hashtable buckets of \p hashes, and has no other
+   *  effect. Calling prefetchNodes with the same hash values some time later lets the buckets
+   *  arrive first, so that the cache misses of both steps overlap with other work.
+   */
+  void
+  prefetchBuckets(const HashSequence& hashes) const;
+
+  /** \brief Hint that entries with the specified hash values are about to be looked up
+   *
+   *  This reads the hashtable buckets of \p hashes, and issues software prefetches of the
+   *  entries found there. It has no other effect.
+   */
+  void
+  prefetchNodes(const HashSequence& hashes) const;
+
   /** \brief Exact match lookup
    *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
    */
   Entry*
   findExactMatch(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
 
+  /** \brief Exact match lookup with precomputed hash values
+   *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
+   *  \pre prefixLen <= name.size()
+   *  \pre hashes[i] == computeHash(name, i) for every i <= prefixLen
+   */
+  Entry*
+  findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+
   /** \brief Longest prefix matching
    *  \return entry whose name is a prefix of \p name and passes \p entrySelector,
    *          where no other entry with a longer name satisfies those requirements;
@@ -157,6 +206,16 @@ public: // matching
   findLongestPrefixMatch(const Name& name,
                          const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Longest prefix matching with precomputed hash values
+   *
+   *  This is equivalent to `findLongestPrefixMatch(name, entrySelector)`, without hashing
+   *  the name again.
+   *  \pre hashes[i] == computeHash(name, i) for every i <= min(name.size(), getMaxDepth())
+   */
+  Entry*
+  findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector = AnyEntry()) const;
+
   /** \brief Equivalent to `findLongestPrefixMatch(entry.getName(), entrySelector)`
    *  \note This overload is more efficient than
    *        `findLongestPrefixMatch(const Name&, const EntrySelector&)` in common cases.
@@ -213,6 +272,15 @@ public: // matching
   findAllMatches(const Name& name,
                  const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief All-prefixes match lookup with precomputed hash values
+   *
+   *  This is equivalent to `findAllMatches(name, entrySelector)`, without hashing the name again.
+   *  \pre hashes[i] == computeHash(name, i) for every i <= min(name.size(), getMaxDepth())
+   */
+  Range
+  findAllMatches(const Name& name, const HashSequence& hashes,
+                 const EntrySelector& entrySelector = AnyEntry()) const;
+
 public: // enumeration
   using const_iterator = Iterator;
 
@@ -273,7 +341,9 @@ public: // enumeration
   }
 
 private:
-  Hashtable m_ht;
+  HashtableOptions m_hashtableOptions;
+  HashtableType m_hashtableType;
+  unique_ptr<HashtableBase> m_ht;
 
   friend class EnumerationImpl;
 };
@@ -31,7 +31,9 @@ namespace nfd {
 namespace pit {
 
 Entry::Entry(const Interest& interest)
-  : m_interest(interest.shared_from_this())
+  : m_interest(retainInterest(interest))
+  , m_inRecords(InRecordCollection::allocator_type(m_inRecordArena))
+  , m_outRecords(OutRecordCollection::allocator_type(m_outRecordArena))
 {
 }
 
@@ -65,6 +67,9 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
   if (it == m_inRecords.end()) {
     m_inRecords.emplace_front(face);
     it = m_inRecords.begin();
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->insert(face, *this);
+    }
   }
 
   it->update(interest);
@@ -78,13 +83,18 @@ Entry::deleteInRecord(const Face& face)
     [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
   if (it != m_inRecords.end()) {
     m_inRecords.erase(it);
+    this->unindexFaceIfUnused(face);
   }
 }
 
 void
 Entry::clearInRecords()
 {
-  m_inRecords.clear();
+  while (!m_inRecords.empty()) {
+    const Face& face = m_inRecords.front().getFace();
+    m_inRecords.pop_front();
+    this->unindexFaceIfUnused(face);
+  }
 }
 
 OutRecordCollection::iterator
@@ -104,6 +114,9 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
   if (it == m_outRecords.end()) {
     m_outRecords.emplace_front(face);
     it = m_outRecords.begin();
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->insert(face, *this);
+    }
   }
 
   it->update(interest);
@@ -117,6 +130,16 @@ Entry::deleteOutRecord(const Face& face)
     [&face] (const OutRecord& outRecord) { return &outRecord.getFace() == &face; });
   if (it != m_outRecords.end()) {
     m_outRecords.erase(it);
+    this->unindexFaceIfUnused(face);
+  }
+}
+
+void
+Entry::unindexFaceIfUnused(const Face& face)
+{
+  if (m_faceIndex != nullptr && getInRecord(face) == m_inRecords.end() &&
+      getOutRecord(face) == m_outRecords.end()) {
+    m_faceIndex->erase(face, *this);
   }
 }
 
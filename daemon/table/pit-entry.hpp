@@ -28,6 +28,9 @@
 
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
+#include "pit-record-allocator.hpp"
+#include "face-index.hpp"
+#include "common/timer-wheel.hpp"
 
 #include <list>
 
@@ -39,13 +42,23 @@ class Entry;
 
 namespace pit {
 
+/** \brief number of in-records, and of out-records, stored inside a PIT entry
+ *
+ *  Records beyond this number are allocated on the heap.
+ */
+const size_t N_INLINE_RECORDS = 2;
+
+// a std::list node consists of two pointers followed by the element
+using InRecordArena = detail::InlineRecordArena<sizeof(InRecord) + 2 * sizeof(void*), N_INLINE_RECORDS>;
+using OutRecordArena = detail::InlineRecordArena<sizeof(OutRecord) + 2 * sizeof(void*), N_INLINE_RECORDS>;
+
 /** \brief An unordered collection of in-records
  */
-typedef std::list<InRecord> InRecordCollection;
+typedef std::list<InRecord, detail::InlineRecordAllocator<InRecord, InRecordArena>> InRecordCollection;
 
 /** \brief An unordered collection of out-records
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef std::list<OutRecord, detail::InlineRecordAllocator<OutRecord, OutRecordArena>> OutRecordCollection;
 
 /** \brief An Interest table entry
  *
@@ -218,9 +231,10 @@ public: // out-record
 public:
   /** \brief Expiry timer
    *
-   *  This timer is used in forwarding pipelines to delete the entry
+   *  This timer is used in forwarding pipelines to delete the entry.
+   *  It is armed on the TimerWheel, so that resetting it does not allocate.
    */
-  scheduler::EventId expiryTimer;
+  WheelTimer expiryTimer;
 
   /** \brief Indicates whether this PIT entry is satisfied
    */
@@ -231,14 +245,29 @@ public:
    */
   time::milliseconds dataFreshnessPeriod = 0_ms;
 
+private:
+  /** \brief remove this entry from the face index if it has no record for \p face
+   */
+  void
+  unindexFaceIfUnused(const Face& face);
+
 private:
   shared_ptr<const Interest> m_interest;
+  // the arenas must be declared before, and thus destroyed after, the record collections
+  InRecordArena m_inRecordArena;
+  OutRecordArena m_outRecordArena;
   InRecordCollection m_inRecords;
   OutRecordCollection m_outRecords;
 
   name_tree::Entry* m_nameTreeEntry = nullptr;
+  /// index of the PIT containing this entry, or nullptr if the entry is not in a PIT
+  FaceIndex<Entry>* m_faceIndex = nullptr;
+  static constexpr uint32_t NO_TOKEN_SLOT = std::numeric_limits<uint32_t>::max();
+  /// PIT token slot assigned to this entry, or NO_TOKEN_SLOT if no token has been issued
+  uint32_t m_tokenSlot = NO_TOKEN_SLOT;
 
   friend class name_tree::Entry;
+  friend class Pit;
 };
 
 } // namespace pit
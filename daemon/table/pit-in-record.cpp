@@ -28,11 +28,25 @@
 namespace nfd {
 namespace pit {
 
+shared_ptr<const Interest>
+retainInterest(const Interest& interest)
+{
+  const Block& wire = interest.wireEncode();
+  if (wire.getBuffer() == nullptr || wire.getBuffer()->size() <= 2 * wire.size()) {
+    return interest.shared_from_this();
+  }
+
+  // copying the Interest keeps its tags; decoding replaces the wire with a right-sized buffer
+  auto copy = make_shared<Interest>(interest);
+  copy->wireDecode(Block(wire.wire(), wire.size()));
+  return copy;
+}
+
 void
 InRecord::update(const Interest& interest)
 {
   FaceRecord::update(interest);
-  m_interest = interest.shared_from_this();
+  m_interest = retainInterest(interest);
 }
 
 } // namespace pit
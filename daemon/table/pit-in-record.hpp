@@ -31,6 +31,15 @@
 namespace nfd {
 namespace pit {
 
+/** \brief obtain a reference to \p interest that is suitable to be retained in the PIT
+ *
+ *  Received packets are decoded in place from receive buffers that can hold a packet of maximum
+ *  size. If \p interest occupies less than half of its buffer, it is copied into its own buffer,
+ *  so that the PIT does not keep the receive buffer alive. Tags are preserved in the copy.
+ */
+shared_ptr<const Interest>
+retainInterest(const Interest& interest);
+
 /** \brief Contains information about an Interest from an incoming face
  */
 class InRecord : public FaceRecord
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_RECORD_ALLOCATOR_HPP
+#define NFD_DAEMON_TABLE_PIT_RECORD_ALLOCATOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace pit {
+namespace detail {
+
+/** \brief Storage for a few in-records or out-records within a PIT entry
+ *  \tparam SlotSize size of each slot, large enough for one node of the record collection
+ *  \tparam NSlots number of slots
+ *
+ *  Most PIT entries have only one or two downstreams and upstreams,
+ *  whose records are then stored here instead of on the heap.
+ */
+template<size_t SlotSize, size_t NSlots>
+class InlineRecordArena : noncopyable
+{
+  static_assert(NSlots <= sizeof(unsigned) * 8, "too many slots");
+
+public:
+  static constexpr size_t SLOT_SIZE = SlotSize;
+
+  /** \return a free slot, or nullptr if \p size does not fit or all slots are in use
+   */
+  void*
+  allocate(size_t size) noexcept
+  {
+    if (size > SlotSize) {
+      return nullptr;
+    }
+    for (size_t i = 0; i < NSlots; ++i) {
+      if ((m_used & (1U << i)) == 0) {
+        m_used |= 1U << i;
+        return &m_slots[i];
+      }
+    }
+    return nullptr;
+  }
+
+  /** \return whether \p p was a slot of this arena
+   */
+  bool
+  deallocate(void* p) noexcept
+  {
+    for (size_t i = 0; i < NSlots; ++i) {
+      if (p == &m_slots[i]) {
+        m_used &= ~(1U << i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::aligned_storage_t<SlotSize, alignof(std::max_align_t)> m_slots[NSlots];
+  unsigned m_used = 0;
+};
+
+/** \brief An allocator that takes nodes from an InlineRecordArena, and from the heap
+ *         when the arena is exhausted
+ *
+ *  A container using this allocator must not be moved or swapped, and must be destroyed
+ *  before the arena. A copy of the container allocates every node from the heap, so that
+ *  it does not share the arena of the original container.
+ */
+template<typename T, typename Arena>
+class InlineRecordAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  InlineRecordAllocator(Arena& arena) noexcept
+    : m_arena(&arena)
+  {
+  }
+
+  /** \brief constructs an allocator that takes all nodes from the heap
+   */
+  InlineRecordAllocator() noexcept
+    : m_arena(nullptr)
+  {
+  }
+
+  template<typename U>
+  InlineRecordAllocator(const InlineRecordAllocator<U, Arena>& other) noexcept
+    : m_arena(other.m_arena)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    // T is the node type of the container; if the arena slots were sized for a different node
+    // layout, every node would silently come from the heap
+    static_assert(sizeof(T) <= Arena::SLOT_SIZE, "container node does not fit in an arena slot");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "container node is over-aligned");
+
+    void* p = n == 1 && m_arena != nullptr ? m_arena->allocate(sizeof(T)) : nullptr;
+    if (p == nullptr) {
+      p = ::operator new(n * sizeof(T));
+    }
+    return static_cast<T*>(p);
+  }
+
+  void
+  deallocate(T* p, size_t) noexcept
+  {
+    if (m_arena == nullptr || !m_arena->deallocate(p)) {
+      ::operator delete(p);
+    }
+  }
+
+  /** \return a heap-only allocator for a copy of the container
+   */
+  InlineRecordAllocator
+  select_on_container_copy_construction() const noexcept
+  {
+    return InlineRecordAllocator();
+  }
+
+  friend bool
+  operator==(const InlineRecordAllocator& lhs, const InlineRecordAllocator& rhs) noexcept
+  {
+    return lhs.m_arena == rhs.m_arena;
+  }
+
+  friend bool
+  operator!=(const InlineRecordAllocator& lhs, const InlineRecordAllocator& rhs) noexcept
+  {
+    return lhs.m_arena != rhs.m_arena;
+  }
+
+private:
+  Arena* m_arena;
+
+  template<typename U, typename A>
+  friend class InlineRecordAllocator;
+};
+
+template<size_t SlotSize, size_t NSlots>
+constexpr size_t InlineRecordArena<SlotSize, NSlots>::SLOT_SIZE;
+
+} // namespace detail
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_RECORD_ALLOCATOR_HPP
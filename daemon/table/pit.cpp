@@ -25,6 +25,8 @@
 
 #include "pit.hpp"
 
+#include <boost/endian/conversion.hpp>
+
 namespace nfd {
 namespace pit {
 
@@ -36,11 +38,23 @@ nteHasPitEntries(const name_tree::Entry& nte)
 
 Pit::Pit(NameTree& nameTree)
   : m_nameTree(nameTree)
+  , m_entryPool(make_shared<SlabPool>())
+{
+}
+
+Pit::~Pit()
 {
+  // entries may outlive the PIT, e.g. when they are referenced by a pending timer;
+  // every entry refers to the face index, including entries without records
+  for (const name_tree::Entry& nte : m_nameTree.fullEnumerate(&nteHasPitEntries)) {
+    for (const auto& entry : nte.getPitEntries()) {
+      entry->m_faceIndex = nullptr;
+    }
+  }
 }
 
 std::pair<shared_ptr<Entry>, bool>
-Pit::findOrInsert(const Interest& interest, bool allowInsert)
+Pit::findOrInsert(const Interest& interest, bool allowInsert, const name_tree::HashSequence* hashes)
 {
   // determine which NameTree entry should the PIT entry be attached onto
   const Name& name = interest.getName();
@@ -51,10 +65,12 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   // ensure NameTree entry exists
   name_tree::Entry* nte = nullptr;
   if (allowInsert) {
-    nte = &m_nameTree.lookup(name, nteDepth);
+    nte = hashes == nullptr ? &m_nameTree.lookup(name, nteDepth) :
+                              &m_nameTree.lookup(name, nteDepth, *hashes);
   }
   else {
-    nte = m_nameTree.findExactMatch(name, nteDepth);
+    nte = hashes == nullptr ? m_nameTree.findExactMatch(name, nteDepth) :
+                              m_nameTree.findExactMatch(name, nteDepth, *hashes);
     if (nte == nullptr) {
       return {nullptr, true};
     }
@@ -76,7 +92,8 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
-  auto entry = make_shared<Entry>(interest);
+  auto entry = std::allocate_shared<Entry>(SlabAllocator<Entry>(m_entryPool), interest);
+  entry->m_faceIndex = &m_faceIndex;
   nte->insertPitEntry(entry);
   ++m_nItems;
   return {entry, true};
@@ -85,8 +102,19 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
 DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
-  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), &nteHasPitEntries);
+  return this->collectDataMatches(data, m_nameTree.findAllMatches(data.getName(), &nteHasPitEntries));
+}
+
+DataMatchResult
+Pit::findAllDataMatches(const Data& data, const name_tree::HashSequence& hashes) const
+{
+  return this->collectDataMatches(data, m_nameTree.findAllMatches(data.getName(), hashes,
+                                                                  &nteHasPitEntries));
+}
 
+DataMatchResult
+Pit::collectDataMatches(const Data& data, const name_tree::Range& ntMatches) const
+{
   DataMatchResult matches;
   for (const auto& nte : ntMatches) {
     for (const auto& pitEntry : nte.getPitEntries()) {
@@ -98,12 +126,101 @@ Pit::findAllDataMatches(const Data& data) const
   return matches;
 }
 
+DataMatchResult
+Pit::findAllDataMatches(const Data& data, const lp::PitToken& token) const
+{
+  Entry* hint = this->findByToken(token);
+  if (hint == nullptr) {
+    return this->findAllDataMatches(data);
+  }
+
+  // The Data matches PIT entries on NameTree entries whose names are prefixes of the Data name,
+  // up to the maximum depth. If the hinted entry matches the Data and is at that depth,
+  // those NameTree entries are the hinted entry's NameTree entry and its ancestors.
+  name_tree::Entry* nte = hint->m_nameTreeEntry;
+  size_t depth = std::min(data.getName().size(), NameTree::getMaxDepth());
+  if (nte->getName().size() != depth || !hint->getInterest().matchesData(data)) {
+    return this->findAllDataMatches(data);
+  }
+
+  DataMatchResult matches;
+  for (; nte != nullptr; nte = nte->getParent()) {
+    for (const auto& pitEntry : nte->getPitEntries()) {
+      if (pitEntry.get() == hint || pitEntry->getInterest().matchesData(data))
+        matches.emplace_back(pitEntry);
+    }
+  }
+
+  return matches;
+}
+
+lp::PitToken
+Pit::issueToken(Entry& entry)
+{
+  BOOST_ASSERT(entry.m_faceIndex == &m_faceIndex);
+
+  if (entry.m_tokenSlot == Entry::NO_TOKEN_SLOT) {
+    if (m_freeTokenSlots.empty()) {
+      entry.m_tokenSlot = static_cast<uint32_t>(m_tokenSlots.size());
+      m_tokenSlots.push_back({&entry, 0});
+    }
+    else {
+      entry.m_tokenSlot = m_freeTokenSlots.back();
+      m_freeTokenSlots.pop_back();
+      m_tokenSlots[entry.m_tokenSlot].entry = &entry;
+    }
+  }
+
+  // token: slot index and generation, each a 32-bit big-endian number
+  uint32_t value[] = {
+    boost::endian::native_to_big(entry.m_tokenSlot),
+    boost::endian::native_to_big(m_tokenSlots[entry.m_tokenSlot].generation),
+  };
+  auto begin = reinterpret_cast<const uint8_t*>(value);
+  ndn::Buffer buffer(begin, begin + sizeof(value));
+  return lp::PitToken(std::make_pair(buffer.cbegin(), buffer.cend()));
+}
+
+Entry*
+Pit::findByToken(const lp::PitToken& token) const
+{
+  uint32_t value[2];
+  if (token.size() != sizeof(value)) {
+    return nullptr;
+  }
+  std::copy(token.begin(), token.end(), reinterpret_cast<uint8_t*>(value));
+
+  uint32_t slot = boost::endian::big_to_native(value[0]);
+  uint32_t generation = boost::endian::big_to_native(value[1]);
+  if (slot >= m_tokenSlots.size() || m_tokenSlots[slot].entry == nullptr ||
+      m_tokenSlots[slot].generation != generation) {
+    return nullptr;
+  }
+  return m_tokenSlots[slot].entry;
+}
+
 void
 Pit::erase(Entry* entry, bool canDeleteNte)
 {
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  if (entry->m_tokenSlot != Entry::NO_TOKEN_SLOT) {
+    TokenSlot& slot = m_tokenSlots[entry->m_tokenSlot];
+    slot.entry = nullptr;
+    ++slot.generation;
+    m_freeTokenSlots.push_back(entry->m_tokenSlot);
+    entry->m_tokenSlot = Entry::NO_TOKEN_SLOT;
+  }
+
+  for (const InRecord& inRecord : entry->getInRecords()) {
+    m_faceIndex.erase(inRecord.getFace(), *entry);
+  }
+  for (const OutRecord& outRecord : entry->getOutRecords()) {
+    m_faceIndex.erase(outRecord.getFace(), *entry);
+  }
+  entry->m_faceIndex = nullptr;
+
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -28,6 +28,9 @@
 
 #include "pit-entry.hpp"
 #include "pit-iterator.hpp"
+#include "common/slab-allocator.hpp"
+
+#include <ndn-cxx/lp/pit-token.hpp>
 
 namespace nfd {
 namespace pit {
@@ -50,6 +53,8 @@ public:
   explicit
   Pit(NameTree& nameTree);
 
+  ~Pit();
+
   /** \return number of entries
    */
   size_t
@@ -58,6 +63,29 @@ public:
     return m_nItems;
   }
 
+  /** \return number of octets of memory reserved for PIT entries
+   *
+   *  This includes the in-records and out-records stored inside each entry,
+   *  but not records beyond N_INLINE_RECORDS, nor the Interests.
+   *  Each entry and in-record refers to an Interest, which occupies its decoded fields plus
+   *  a buffer of its encoded size (see retainInterest), in addition to this figure.
+   */
+  size_t
+  getNReservedBytes() const
+  {
+    return m_entryPool->getNReservedBytes();
+  }
+
+  /** \return number of octets of memory occupied by each PIT entry,
+   *          excluding the Interests that it refers to
+   *  \sa getNReservedBytes
+   */
+  size_t
+  getEntrySize() const
+  {
+    return m_entryPool->getBlockSize();
+  }
+
   /** \brief Finds a PIT entry for \p interest
    *  \param interest the Interest
    *  \return an existing entry with same Name and Selectors; otherwise nullptr
@@ -65,7 +93,7 @@ public:
   shared_ptr<Entry>
   find(const Interest& interest) const
   {
-    return const_cast<Pit*>(this)->findOrInsert(interest, false).first;
+    return const_cast<Pit*>(this)->findOrInsert(interest, false, nullptr).first;
   }
 
   /** \brief Inserts a PIT entry for \p interest
@@ -76,7 +104,21 @@ public:
   std::pair<shared_ptr<Entry>, bool>
   insert(const Interest& interest)
   {
-    return this->findOrInsert(interest, true);
+    return this->findOrInsert(interest, true, nullptr);
+  }
+
+  /** \brief Inserts a PIT entry for \p interest, with precomputed name hashes
+   *  \param interest the Interest; must be created with make_shared
+   *  \param hashes hash values of the prefixes of the Interest name
+   *  \pre hashes[i] == name_tree::computeHash(interest.getName(), i)
+   *       for every i <= min(interest.getName().size(), NameTree::getMaxDepth())
+   *
+   *  This is equivalent to `insert(interest)`, without hashing the name again.
+   */
+  std::pair<shared_ptr<Entry>, bool>
+  insert(const Interest& interest, const name_tree::HashSequence& hashes)
+  {
+    return this->findOrInsert(interest, true, &hashes);
   }
 
   /** \brief Performs a Data match
@@ -85,6 +127,45 @@ public:
   DataMatchResult
   findAllDataMatches(const Data& data) const;
 
+  /** \brief Performs a Data match, with precomputed name hashes
+   *  \param data the Data
+   *  \param hashes hash values of the prefixes of the Data name
+   *  \pre hashes[i] == name_tree::computeHash(data.getName(), i)
+   *       for every i <= min(data.getName().size(), NameTree::getMaxDepth())
+   *
+   *  This is equivalent to `findAllDataMatches(data)`, without hashing the name again.
+   */
+  DataMatchResult
+  findAllDataMatches(const Data& data, const name_tree::HashSequence& hashes) const;
+
+  /** \brief Performs a Data match, using a PIT token as a hint
+   *  \param data the Data
+   *  \param token PIT token carried by \p data
+   *  \return an iterable of all PIT entries matching \p data
+   *
+   *  If \p token was issued by issueToken() for an entry that is still in the PIT, and that entry
+   *  matches \p data, the matches are found by visiting that entry's NameTree entry and its
+   *  ancestors, without computing any hash. Otherwise, this is equivalent to
+   *  `findAllDataMatches(data)`.
+   */
+  DataMatchResult
+  findAllDataMatches(const Data& data, const lp::PitToken& token) const;
+
+  /** \brief Issues a PIT token that refers to \p entry
+   *  \pre entry is in this PIT
+   *
+   *  The token is valid until the entry is erased. Issuing more tokens for the same entry
+   *  returns the same token.
+   */
+  lp::PitToken
+  issueToken(Entry& entry);
+
+  /** \return the entry referred to by \p token, or nullptr if \p token is not a valid token
+   *          issued by this PIT
+   */
+  Entry*
+  findByToken(const lp::PitToken& token) const;
+
   /** \brief Deletes an entry
    */
   void
@@ -98,6 +179,14 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+  /** \return entries that have an in-record or out-record for \p face
+   */
+  std::vector<Entry*>
+  getEntriesByFace(const Face& face) const
+  {
+    return m_faceIndex.getEntries(face);
+  }
+
 public: // enumeration
   typedef Iterator const_iterator;
 
@@ -125,17 +214,35 @@ private:
   /** \brief Finds or inserts a PIT entry for \p interest
    *  \param interest the Interest; must be created with make_shared if allowInsert
    *  \param allowInsert whether inserting a new entry is allowed
+   *  \param hashes hash values of the prefixes of the Interest name, or nullptr to compute them
    *  \return if allowInsert, a new or existing entry with same Name+Selectors,
    *          and true for new entry, false for existing entry;
    *          if not allowInsert, an existing entry with same Name+Selectors and false,
    *          or `{nullptr, true}` if there's no existing entry
    */
   std::pair<shared_ptr<Entry>, bool>
-  findOrInsert(const Interest& interest, bool allowInsert);
+  findOrInsert(const Interest& interest, bool allowInsert, const name_tree::HashSequence* hashes);
+
+  DataMatchResult
+  collectDataMatches(const Data& data, const name_tree::Range& ntMatches) const;
 
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// PIT entries are allocated from this pool, which is shared with every entry
+  shared_ptr<SlabPool> m_entryPool;
+  /// PIT entries by face of their in-records and out-records
+  FaceIndex<Entry> m_faceIndex;
+
+  struct TokenSlot
+  {
+    Entry* entry;
+    /// incremented whenever the slot is released, so that tokens of erased entries are invalid
+    uint32_t generation;
+  };
+  /// PIT token slots; a token encodes a slot index and the slot's generation
+  std::vector<TokenSlot> m_tokenSlots;
+  std::vector<uint32_t> m_freeTokenSlots;
 };
 
 } // namespace pit
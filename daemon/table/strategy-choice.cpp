@@ -65,6 +65,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
   name_tree::Entry& nte = m_nameTree.lookup(Name());
   nte.setStrategyChoiceEntry(std::move(entry));
   ++m_nItems;
+  ++m_generation;
 }
 
 StrategyChoice::InsertResult
@@ -111,6 +112,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(std::move(strategy));
+  ++m_generation;
   return InsertResult::OK;
 }
 
@@ -160,6 +162,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -187,6 +190,32 @@ StrategyChoice::findEffectiveStrategyImpl(const K& key) const
   return nte->getStrategyChoiceEntry()->getStrategy();
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategyCached(const name_tree::Entry& nte) const
+{
+  // The root entry always has a StrategyChoice entry, so that the walk ends before the root.
+  // Every NameTree entry visited on the way inherits the strategy, and caches it, so that
+  // the next lookup from a sibling stops at the common parent.
+  Strategy* strategy = nullptr;
+  const name_tree::Entry* found = &nte;
+  for (; ; found = found->getParent()) {
+    BOOST_ASSERT(found != nullptr);
+    if (found->getStrategyChoiceEntry() != nullptr) {
+      strategy = &found->getStrategyChoiceEntry()->getStrategy();
+      break;
+    }
+    strategy = found->getCachedStrategy(m_generation);
+    if (strategy != nullptr) {
+      break;
+    }
+  }
+
+  for (const name_tree::Entry* e = &nte; e != found; e = e->getParent()) {
+    e->setCachedStrategy(*strategy, m_generation);
+  }
+  return *strategy;
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 {
@@ -196,13 +225,22 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  return this->findEffectiveStrategyImpl(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+  if (nte->getName().size() < pitEntry.getName().size()) {
+    // PIT entry name either exceeds depth limit or ends with an implicit digest,
+    // so that a deeper StrategyChoice entry may apply
+    return this->findEffectiveStrategyImpl(pitEntry);
+  }
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  return this->findEffectiveStrategyImpl(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 static inline void
@@ -187,6 +187,12 @@ private:
   fw::Strategy&
   findEffectiveStrategyImpl(const K& key) const;
 
+  /** \brief find the effective strategy of \p nte, using and filling the cache on
+   *         \p nte and its ancestors
+   */
+  fw::Strategy&
+  findEffectiveStrategyCached(const name_tree::Entry& nte) const;
+
   Range
   getRange() const;
 
@@ -194,6 +200,11 @@ private:
   Forwarder& m_forwarder;
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+
+  /** \brief incremented whenever the effective strategy of any name may change,
+   *         which invalidates all effective strategies cached on NameTree entries
+   */
+  uint64_t m_generation = 1;
 };
 
 std::ostream&
@@ -27,6 +27,8 @@
 
 #include "tests/test-common.hpp"
 
+#include <thread>
+
 namespace nfd {
 namespace tests {
 
@@ -66,6 +68,75 @@ BOOST_AUTO_TEST_CASE(ByteCnt)
   BOOST_CHECK_EQUAL(counter, 21);
 }
 
+BOOST_AUTO_TEST_CASE(DurationCnt)
+{
+  DurationCounter counter;
+
+  uint64_t observation = counter; // implicit conversion
+  BOOST_CHECK_EQUAL(observation, 0);
+
+  counter += 5_ms;
+  BOOST_CHECK_EQUAL(counter, 5000000);
+  counter += 20_ns;
+  BOOST_CHECK_EQUAL(counter, 5000020);
+}
+
+BOOST_AUTO_TEST_CASE(MultiThreaded)
+{
+  PacketCounter packets;
+  ByteCounter bytes;
+  ++packets;
+  bytes += 10;
+
+  const size_t nThreads = 8;
+  const size_t nIncrements = 100000;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < nThreads; ++i) {
+    threads.emplace_back([&] {
+      for (size_t j = 0; j < nIncrements; ++j) {
+        ++packets;
+        bytes += 2;
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  BOOST_CHECK_EQUAL(packets, 1 + nThreads * nIncrements);
+  BOOST_CHECK_EQUAL(bytes, 10 + 2 * nThreads * nIncrements);
+
+  packets.set(5);
+  BOOST_CHECK_EQUAL(packets, 5);
+  std::thread([&] { ++packets; }).join();
+  BOOST_CHECK_EQUAL(packets, 6);
+}
+
+BOOST_AUTO_TEST_CASE(ManyThreads)
+{
+  // more threads than exclusive shards, some of which share a shard
+  PacketCounter counter;
+  const size_t nThreads = detail::CounterShards::MAX_EXCLUSIVE_SHARDS * 2;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < nThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (int j = 0; j < 1000; ++j) {
+        ++counter;
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  BOOST_CHECK_EQUAL(counter, nThreads * 1000);
+
+  // shards of exited threads are reused
+  for (size_t i = 0; i < nThreads; ++i) {
+    std::thread([&counter] { ++counter; }).join();
+  }
+  BOOST_CHECK_EQUAL(counter, nThreads * 1001);
+}
+
 BOOST_AUTO_TEST_CASE(SizeCnt)
 {
   std::vector<int> v;
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/spsc-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestSpscRing)
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  SpscRing<int> ring1(5);
+  BOOST_CHECK_EQUAL(ring1.capacity(), 8);
+
+  SpscRing<int> ring2(16);
+  BOOST_CHECK_EQUAL(ring2.capacity(), 16);
+
+  SpscRing<int> ring3(0);
+  BOOST_CHECK_EQUAL(ring3.capacity(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  SpscRing<int> ring(4);
+  BOOST_CHECK(ring.empty());
+
+  int item = 0;
+  BOOST_CHECK_EQUAL(ring.tryPop(item), false);
+
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(ring.tryPush(i + 1), true);
+  }
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+  BOOST_CHECK_EQUAL(ring.tryPush(5), false);
+
+  BOOST_CHECK_EQUAL(ring.tryPop(item), true);
+  BOOST_CHECK_EQUAL(item, 1);
+  BOOST_CHECK_EQUAL(ring.tryPush(5), true);
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+
+  for (int i = 2; i <= 5; ++i) {
+    BOOST_CHECK_EQUAL(ring.tryPop(item), true);
+    BOOST_CHECK_EQUAL(item, i);
+  }
+  BOOST_CHECK_EQUAL(ring.tryPop(item), false);
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ReleaseOnPop)
+{
+  SpscRing<shared_ptr<int>> ring(2);
+  auto p = make_shared<int>(1);
+  weak_ptr<int> weak = p;
+
+  BOOST_CHECK_EQUAL(ring.tryPush(std::move(p)), true);
+  shared_ptr<int> popped;
+  BOOST_CHECK_EQUAL(ring.tryPop(popped), true);
+  popped.reset();
+  // the ring does not retain a reference in the slot
+  BOOST_CHECK(weak.expired());
+
+  // an item that cannot be pushed is left unchanged
+  ring.tryPush(make_shared<int>(2));
+  ring.tryPush(make_shared<int>(3));
+  auto q = make_shared<int>(4);
+  BOOST_CHECK_EQUAL(ring.tryPush(std::move(q)), false);
+  BOOST_REQUIRE(q != nullptr);
+  BOOST_CHECK_EQUAL(*q, 4);
+}
+
+BOOST_AUTO_TEST_CASE(TwoThreads)
+{
+  SpscRing<uint64_t> ring(64);
+  const uint64_t nItems = 100000;
+
+  std::thread producer([&ring, nItems] {
+    for (uint64_t i = 0; i < nItems; ) {
+      if (ring.tryPush(uint64_t(i))) {
+        ++i;
+      }
+      else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint64_t expected = 0;
+  bool isInOrder = true;
+  while (expected < nItems) {
+    uint64_t item = 0;
+    if (ring.tryPop(item)) {
+      isInOrder = isInOrder && item == expected;
+      ++expected;
+    }
+    else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  BOOST_CHECK(isInOrder);
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscRing
+
+} // namespace tests
+} // namespace nfd
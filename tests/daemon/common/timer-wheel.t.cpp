@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/timer-wheel.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestTimerWheel, GlobalIoTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Fire)
+{
+  WheelTimer timer;
+  int nFired = 0;
+  getTimerWheel().schedule(timer, 10_ms, [&] { ++nFired; });
+  BOOST_CHECK(timer.isArmed());
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 1);
+
+  advanceClocks(1_ms, 9);
+  BOOST_CHECK_EQUAL(nFired, 0);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nFired, 1);
+  BOOST_CHECK(!timer.isArmed());
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 0);
+
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(nFired, 1);
+}
+
+BOOST_AUTO_TEST_CASE(NotEarly)
+{
+  advanceClocks(300_us);
+
+  WheelTimer timer;
+  bool hasFired = false;
+  getTimerWheel().schedule(timer, 2_ms, [&] { hasFired = true; });
+
+  advanceClocks(100_us, 20);
+  BOOST_CHECK_EQUAL(hasFired, false);
+  advanceClocks(100_us, 10);
+  BOOST_CHECK_EQUAL(hasFired, true);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroDelay)
+{
+  WheelTimer t1;
+  WheelTimer t2;
+  int nFired = 0;
+  getTimerWheel().schedule(t1, 0_ms, [&] { ++nFired; });
+  getTimerWheel().schedule(t2, -5_ms, [&] { ++nFired; });
+
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(nFired, 2);
+
+  // armed again in the middle of a tick
+  getTimerWheel().schedule(t1, 0_ms, [&] { ++nFired; });
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(nFired, 3);
+
+  // armed with a positive delay in the middle of a tick, rounded up to the next tick
+  getTimerWheel().schedule(t1, 1_ns, [&] { ++nFired; });
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(nFired, 3);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nFired, 4);
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+  WheelTimer timer;
+  bool hasFired = false;
+  getTimerWheel().schedule(timer, 10_ms, [&] { hasFired = true; });
+  advanceClocks(5_ms);
+
+  timer.cancel();
+  BOOST_CHECK(!timer.isArmed());
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 0);
+  timer.cancel(); // no effect
+
+  advanceClocks(5_ms, 4);
+  BOOST_CHECK_EQUAL(hasFired, false);
+}
+
+BOOST_AUTO_TEST_CASE(Rearm)
+{
+  WheelTimer timer;
+  int result = 0;
+  getTimerWheel().schedule(timer, 10_ms, [&] { result = 1; });
+  advanceClocks(5_ms);
+  getTimerWheel().schedule(timer, 20_ms, [&] { result = 2; });
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 1);
+
+  advanceClocks(1_ms, 19);
+  BOOST_CHECK_EQUAL(result, 0);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(result, 2);
+
+  // earlier than the pending driver event
+  getTimerWheel().schedule(timer, 1_s, [&] { result = 3; });
+  getTimerWheel().schedule(timer, 3_ms, [&] { result = 4; });
+  advanceClocks(1_ms, 3);
+  BOOST_CHECK_EQUAL(result, 4);
+}
+
+BOOST_AUTO_TEST_CASE(Periodic)
+{
+  WheelTimer timer;
+  int nFired = 0;
+  std::function<void()> callback = [&] {
+    ++nFired;
+    getTimerWheel().schedule(timer, 10_ms, callback);
+  };
+  getTimerWheel().schedule(timer, 10_ms, callback);
+
+  advanceClocks(1_ms, 100);
+  BOOST_CHECK_EQUAL(nFired, 10);
+  timer.cancel();
+}
+
+BOOST_AUTO_TEST_CASE(Cascade)
+{
+  const std::vector<time::milliseconds> delays{63_ms, 64_ms, 100_ms, 4095_ms, 4096_ms, 5000_ms, 300_s};
+  std::vector<WheelTimer> timers(delays.size());
+  std::vector<time::steady_clock::TimePoint> firedAt(delays.size());
+
+  auto start = time::steady_clock::now();
+  for (size_t i = 0; i < timers.size(); ++i) {
+    getTimerWheel().schedule(timers[i], delays[i], [&, i] { firedAt[i] = time::steady_clock::now(); });
+  }
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), timers.size());
+
+  advanceClocks(1_ms, 6000);
+  advanceClocks(1_s, 294);
+  advanceClocks(1_ms, 1000);
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 0);
+
+  for (size_t i = 0; i < timers.size(); ++i) {
+    BOOST_TEST_CONTEXT("delay=" << delays[i]) {
+      BOOST_CHECK_EQUAL(firedAt[i] - start, delays[i]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BeyondRange)
+{
+  // farther than the range of the top level
+  WheelTimer timer;
+  bool hasFired = false;
+  getTimerWheel().schedule(timer, 10_h, [&] { hasFired = true; });
+
+  advanceClocks(1_h, 9);
+  advanceClocks(1_min, 59);
+  advanceClocks(1_s, 59);
+  advanceClocks(1_ms, 999);
+  BOOST_CHECK_EQUAL(hasFired, false);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(hasFired, true);
+}
+
+BOOST_AUTO_TEST_CASE(CallbackOwnsTimer)
+{
+  struct Owner
+  {
+    WheelTimer timer;
+  };
+
+  auto owner1 = make_shared<Owner>();
+  weak_ptr<Owner> weak1 = owner1;
+  getTimerWheel().schedule(owner1->timer, 10_ms, [owner1] {});
+  owner1.reset();
+
+  auto owner2 = make_shared<Owner>();
+  weak_ptr<Owner> weak2 = owner2;
+  Owner* raw2 = owner2.get();
+  getTimerWheel().schedule(owner2->timer, 10_ms, [owner2] {});
+  owner2.reset();
+
+  // the callback holds the last reference, so cancelling destroys the owner
+  raw2->timer.cancel();
+  BOOST_CHECK(weak2.expired());
+
+  BOOST_CHECK(!weak1.expired());
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK(weak1.expired());
+  BOOST_CHECK_EQUAL(getTimerWheel().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyWheel)
+{
+  WheelTimer timer;
+  bool hasFired = false;
+  {
+    TimerWheel wheel(getScheduler());
+    wheel.schedule(timer, 10_ms, [&] { hasFired = true; });
+    BOOST_CHECK(timer.isArmed());
+  }
+  BOOST_CHECK(!timer.isArmed());
+  timer.cancel(); // no effect
+
+  advanceClocks(1_ms, 20);
+  BOOST_CHECK_EQUAL(hasFired, false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTimerWheel
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/codel.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+class CodelFixture
+{
+protected:
+  CodelFixture()
+    : codel(makeOptions())
+    , t0(time::steady_clock::now())
+  {
+  }
+
+  static Codel::Options
+  makeOptions()
+  {
+    Codel::Options options;
+    options.target = 5_ms;
+    options.interval = 100_ms;
+    options.minQueueBytes = 1000;
+    return options;
+  }
+
+  bool
+  shouldDrop(time::nanoseconds sojournTime, time::nanoseconds sinceT0, size_t queueBytes = 10000)
+  {
+    return codel.shouldDrop(sojournTime, queueBytes, t0 + sinceT0);
+  }
+
+protected:
+  Codel codel;
+  time::steady_clock::TimePoint t0;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestCodel, CodelFixture)
+
+BOOST_AUTO_TEST_CASE(BelowTarget)
+{
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(shouldDrop(4_ms, time::milliseconds(i * 10)), false);
+  }
+  BOOST_CHECK_EQUAL(codel.isDropping(), false);
+}
+
+BOOST_AUTO_TEST_CASE(DropAfterInterval)
+{
+  // sojourn time must stay above target for an interval before the first drop
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 0_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 50_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 99_ms), false);
+  BOOST_CHECK_EQUAL(codel.isDropping(), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 100_ms), true);
+  BOOST_CHECK_EQUAL(codel.isDropping(), true);
+
+  // drops are spaced by interval/sqrt(count)
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 100_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 199_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 200_ms), true); // 100ms after the first drop
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 270_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 271_ms), true); // 70.7ms after the second drop
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 328_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 329_ms), true); // 57.7ms after the third drop
+  BOOST_CHECK_EQUAL(codel.isDropping(), true);
+}
+
+BOOST_AUTO_TEST_CASE(LeaveAndResume)
+{
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 0_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 100_ms), true);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 200_ms), true);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 271_ms), true);
+
+  // sojourn time below target: leave dropping state
+  BOOST_CHECK_EQUAL(shouldDrop(1_ms, 300_ms), false);
+  BOOST_CHECK_EQUAL(codel.isDropping(), false);
+
+  // an interval above target is needed again before dropping
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 400_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 450_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 500_ms), true);
+  BOOST_CHECK_EQUAL(codel.isDropping(), true);
+
+  // dropping state was left recently, so the drop rate resumes from count=2 instead of 1
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 570_ms), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 571_ms), true);
+}
+
+BOOST_AUTO_TEST_CASE(MinQueueBytes)
+{
+  // a queue holding no more than minQueueBytes is never dropped from
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 0_ms, 1000), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 100_ms, 1000), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 200_ms, 1000), false);
+  BOOST_CHECK_EQUAL(codel.isDropping(), false);
+
+  // the interval restarts when the queue grows beyond minQueueBytes
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 250_ms, 1001), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 300_ms, 1001), false);
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 350_ms, 1001), true);
+
+  // and dropping stops when it shrinks back
+  BOOST_CHECK_EQUAL(shouldDrop(10_ms, 500_ms, 1000), false);
+  BOOST_CHECK_EQUAL(codel.isDropping(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCodel
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -60,7 +60,10 @@ public:
   }
 
   using NullTransport::setMtu;
+  using NullTransport::setSendQueueSamplingInterval;
   using NullTransport::setState;
+  using NullTransport::beginReceiveBurst;
+  using NullTransport::endReceiveBurst;
 
   ssize_t
   getSendQueueLength() override
@@ -80,6 +83,14 @@ public:
     receive(block);
   }
 
+  void
+  reportExtendedCounters(const CounterReporter& report) const override
+  {
+    for (const auto& counter : extendedCounters) {
+      report(counter.first, counter.second);
+    }
+  }
+
 protected:
   bool
   canChangePersistencyToImpl(ndn::nfd::FacePersistency) const override
@@ -103,6 +114,7 @@ private:
 public:
   std::vector<ndn::nfd::FacePersistency> persistencyHistory;
   std::vector<Block> sentPackets;
+  std::map<std::string, uint64_t> extendedCounters;
 
 private:
   ssize_t m_sendQueueLength = 0;
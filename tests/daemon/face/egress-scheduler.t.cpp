@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/egress-scheduler.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+class EgressSchedulerFixture
+{
+protected:
+  EgressSchedulerFixture()
+  {
+    EgressScheduler::Options options;
+    options.quantum = 1000;
+    options.capacity = 3000;
+    scheduler.setOptions(options);
+  }
+
+  void
+  enqueue(const Name& flow, lp::Sequence id, size_t size)
+  {
+    lp::Packet pkt;
+    pkt.add<lp::SequenceField>(id);
+    scheduler.enqueue({tlv::Data, 0, flow}, {std::move(pkt), false, size});
+  }
+
+  std::vector<lp::Sequence>
+  dequeueAll()
+  {
+    std::vector<lp::Sequence> ids;
+    while (!scheduler.empty()) {
+      ids.push_back(scheduler.dequeue().packet.get<lp::SequenceField>());
+    }
+    return ids;
+  }
+
+protected:
+  EgressScheduler scheduler{{}};
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestEgressScheduler, EgressSchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(Classify)
+{
+  auto i1 = makeInterest("/A/B");
+  auto i2 = makeInterest("/A/C/D");
+  auto d1 = makeData("/A/B");
+
+  auto k1 = scheduler.classify(tlv::Interest, i1->getName());
+  BOOST_CHECK_EQUAL(k1.packetType, tlv::Interest);
+  BOOST_CHECK_EQUAL(k1.prefix, "/A");
+  BOOST_CHECK_EQUAL(scheduler.classify(tlv::Interest, i2->getName()).prefix, "/A");
+
+  auto k2 = scheduler.classify(tlv::Data, d1->getName());
+  BOOST_CHECK_EQUAL(k2.packetType, tlv::Data);
+  BOOST_CHECK_EQUAL(k2.prefix, "/A");
+
+  auto options = scheduler.getOptions();
+  options.flowPrefixLength = 0;
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.classify(tlv::Interest, i1->getName()).prefix, "/");
+
+  options.flowPrefixLength = 5;
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.classify(tlv::Interest, i2->getName()).prefix, "/A/C/D");
+}
+
+BOOST_AUTO_TEST_CASE(RoundRobin)
+{
+  for (lp::Sequence id = 1; id <= 5; ++id) {
+    enqueue("/A", id, 1000);
+  }
+  enqueue("/B", 11, 1000);
+  enqueue("/B", 12, 1000);
+  BOOST_CHECK_EQUAL(scheduler.size(), 7);
+  BOOST_CHECK_EQUAL(scheduler.getQueuedBytes(), 7000);
+  BOOST_CHECK_EQUAL(scheduler.getNFlows(), 2);
+
+  std::vector<lp::Sequence> expected{1, 11, 2, 12, 3, 4, 5};
+  auto actual = dequeueAll();
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(scheduler.size(), 0);
+  BOOST_CHECK_EQUAL(scheduler.getQueuedBytes(), 0);
+  BOOST_CHECK_EQUAL(scheduler.getNFlows(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Deficit)
+{
+  // flow A sends larger packets than the quantum, and must accumulate deficit over rounds
+  enqueue("/A", 1, 1500);
+  enqueue("/A", 2, 1500);
+  enqueue("/A", 3, 1500);
+  // flow B sends several small packets in each round
+  for (lp::Sequence id = 11; id <= 14; ++id) {
+    enqueue("/B", id, 500);
+  }
+
+  std::vector<lp::Sequence> expected{11, 12, 1, 13, 14, 2, 3};
+  auto actual = dequeueAll();
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(NewFlowServedNextRound)
+{
+  for (lp::Sequence id = 1; id <= 4; ++id) {
+    enqueue("/bulk", id, 1000);
+  }
+  BOOST_CHECK_EQUAL(scheduler.dequeue().packet.get<lp::SequenceField>(), 1);
+
+  // an interactive packet does not wait behind the backlog of the bulk flow
+  enqueue("/ping", 11, 100);
+  std::vector<lp::Sequence> expected{11, 2, 3, 4};
+  auto actual = dequeueAll();
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  enqueue("/A", 1, 1000);
+  enqueue("/A", 2, 1000);
+  enqueue("/B", 11, 500);
+  BOOST_CHECK_EQUAL(scheduler.isOverCapacity(), false);
+  enqueue("/A", 3, 1000);
+  BOOST_CHECK_EQUAL(scheduler.isOverCapacity(), true);
+
+  // the head of the longest flow is dropped
+  BOOST_CHECK_EQUAL(scheduler.dropFromLongestFlow().packet.get<lp::SequenceField>(), 1);
+  BOOST_CHECK_EQUAL(scheduler.isOverCapacity(), false);
+  BOOST_CHECK_EQUAL(scheduler.size(), 3);
+  BOOST_CHECK_EQUAL(scheduler.getQueuedBytes(), 2500);
+
+  std::vector<lp::Sequence> expected{2, 11, 3};
+  auto actual = dequeueAll();
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestEgressScheduler
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -323,6 +323,34 @@ BOOST_AUTO_TEST_CASE(Omitted)
   BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(IoBackend)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        listen no
+        io_backend packet_mmap
+        mcast yes
+      }
+    }
+  )CONFIG";
+
+#ifdef __linux__
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  checkChannelListEqual(factory, this->listUrisOfAvailableNetifs());
+  BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), netifs.size());
+#else
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+#endif // __linux__
+}
+
 BOOST_AUTO_TEST_CASE(BadListen)
 {
   const std::string CONFIG = R"CONFIG(
@@ -370,6 +398,22 @@ BOOST_AUTO_TEST_CASE(BadIdleTimeout)
   BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadIoBackend)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        io_backend af_xdp
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(BadMcast)
 {
   const std::string CONFIG = R"CONFIG(
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/ethernet-packet-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#ifdef __linux__
+#include <net/if.h>
+#include <poll.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestEthernetPacketRing)
+
+#ifdef __linux__
+
+class LoopbackRingFixture
+{
+protected:
+  LoopbackRingFixture()
+  {
+    int ifIndex = static_cast<int>(::if_nametoindex("lo"));
+    if (ifIndex == 0)
+      return;
+
+    try {
+      ring = make_unique<EthernetPacketRing>("lo", ifIndex);
+      ring->activate();
+    }
+    catch (const EthernetPacketRing::Error& e) {
+      // opening an AF_PACKET socket requires CAP_NET_RAW
+      BOOST_TEST_MESSAGE("cannot open a packet ring on lo: " << e.what());
+      ring.reset();
+    }
+  }
+
+  /** \brief reads frames from the ring until \p n NDN payloads of type 300 have been received
+   *         or no frame arrives for one second
+   */
+  std::vector<Block>
+  receive(size_t n)
+  {
+    std::vector<Block> received;
+    int fd = ring->getFd();
+    while (received.size() < n) {
+      const uint8_t* pkt;
+      size_t len;
+      std::string err;
+      std::tie(pkt, len, err) = ring->readNextPacket();
+      if (pkt == nullptr) {
+        BOOST_REQUIRE_EQUAL(err, "");
+        pollfd pfd{fd, POLLIN, 0};
+        if (::poll(&pfd, 1, 1000) <= 0)
+          break;
+        continue;
+      }
+
+      BOOST_REQUIRE_GE(len, ethernet::HDR_LEN + ethernet::MIN_DATA_LEN);
+      bool isOk = false;
+      Block payload;
+      std::tie(isOk, payload) = Block::fromBuffer(pkt + ethernet::HDR_LEN, len - ethernet::HDR_LEN);
+      if (isOk && payload.type() == 300) {
+        received.push_back(payload);
+      }
+    }
+    ::close(fd);
+    return received;
+  }
+
+protected:
+  unique_ptr<EthernetPacketRing> ring;
+  // lo has an all-zero hardware address, so frames sent to it are looped back as PACKET_HOST
+  ethernet::Address loAddress;
+};
+
+#define SKIP_IF_NO_LOOPBACK_RING() \
+  do { \
+    if (this->ring == nullptr) { \
+      BOOST_WARN_MESSAGE(false, "skipping assertions that require a packet ring on lo"); \
+      return; \
+    } \
+  } while (false)
+
+BOOST_FIXTURE_TEST_CASE(Exchange, LoopbackRingFixture)
+{
+  SKIP_IF_NO_LOOPBACK_RING();
+
+  // fewer frames than the transmit ring can hold, including one shorter than the minimum payload
+  std::vector<Block> sent;
+  sent.push_back(ndn::encoding::makeEmptyBlock(300));
+  for (int i = 1; i < 32; ++i) {
+    sent.push_back(ndn::encoding::makeStringBlock(300, std::string(i * 40, 'a' + i % 26)));
+  }
+  for (const auto& block : sent) {
+    BOOST_REQUIRE_MESSAGE(ring->send(loAddress, loAddress, block), ring->getLastError());
+  }
+
+  size_t capacity = ring->getTxRingCapacity();
+  // without a transmit ring, every frame was sent immediately
+  BOOST_CHECK_EQUAL(ring->getNQueued(), capacity > 0 ? sent.size() : 0);
+  BOOST_CHECK_EQUAL(ring->getNTxDropped(), 0);
+
+  BOOST_REQUIRE_MESSAGE(ring->flush(), ring->getLastError());
+  BOOST_CHECK_EQUAL(ring->getNQueued(), 0);
+
+  // each frame is received once, in order; the copy seen on the way out is skipped
+  std::vector<Block> received = receive(sent.size() + 1);
+  BOOST_REQUIRE_EQUAL(received.size(), sent.size());
+  for (size_t i = 0; i < sent.size(); ++i) {
+    BOOST_CHECK(received[i] == sent[i]);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(ExchangeBeyondCapacity, LoopbackRingFixture)
+{
+  SKIP_IF_NO_LOOPBACK_RING();
+
+  // lo transmits synchronously, so a full ring is always emptied by the implicit flush
+  // in send() and no frame is dropped
+  size_t nFrames = ring->getTxRingCapacity() * 3 + 5;
+  std::vector<Block> sent;
+  for (size_t i = 0; i < nFrames; ++i) {
+    sent.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    BOOST_REQUIRE_MESSAGE(ring->send(loAddress, loAddress, sent.back()), ring->getLastError());
+  }
+  BOOST_REQUIRE_MESSAGE(ring->flush(), ring->getLastError());
+  BOOST_CHECK_EQUAL(ring->getNQueued(), 0);
+  BOOST_CHECK_EQUAL(ring->getNTxDropped(), 0);
+
+  std::vector<Block> received = receive(nFrames);
+  BOOST_REQUIRE_EQUAL(received.size(), nFrames);
+  for (size_t i = 0; i < nFrames; ++i) {
+    BOOST_CHECK(received[i] == sent[i]);
+  }
+  BOOST_CHECK_EQUAL(ring->getNDropped(), 0);
+}
+
+#else // __linux__
+
+BOOST_AUTO_TEST_CASE(NotSupported)
+{
+  BOOST_CHECK_THROW(EthernetPacketRing("lo", 1), EthernetPacketRing::Error);
+}
+
+#endif // __linux__
+
+BOOST_AUTO_TEST_SUITE_END() // TestEthernetPacketRing
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -24,6 +24,7 @@
  */
 
 #include "face/face-system.hpp"
+#include "face/io-thread.hpp"
 #include "face-system-fixture.hpp"
 
 #include "tests/test-common.hpp"
@@ -159,6 +160,58 @@ BOOST_AUTO_TEST_CASE(ChangeProvidedSchemes)
   BOOST_CHECK_EQUAL(faceSystem.getFactoryByScheme("s3"), f1);
 }
 
+BOOST_AUTO_TEST_CASE(IoThreads)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_threads 2
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  BOOST_CHECK(faceSystem.getIoThreadPool() == nullptr);
+
+  parseConfig(CONFIG, false);
+  BOOST_REQUIRE(faceSystem.getIoThreadPool() != nullptr);
+  BOOST_CHECK_EQUAL(faceSystem.getIoThreadPool()->size(), 2);
+  IoThreadPool* pool = faceSystem.getIoThreadPool();
+
+  // the pool is not resized on reload
+  const std::string CONFIG_RELOAD = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_threads 4
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG_RELOAD, false);
+  BOOST_CHECK(faceSystem.getIoThreadPool() == pool);
+  BOOST_CHECK_EQUAL(faceSystem.getIoThreadPool()->size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(BadIoThreads)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_threads 65
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ProcessConfig
 
 BOOST_AUTO_TEST_SUITE_END() // TestFaceSystem
@@ -910,6 +910,115 @@ BOOST_AUTO_TEST_CASE(DefaultThreshold)
 
 BOOST_AUTO_TEST_SUITE_END() // CongestionMark
 
+BOOST_AUTO_TEST_SUITE(EgressScheduling)
+
+static uint32_t
+getNetPacketType(const Block& wire)
+{
+  lp::Packet pkt(wire);
+  ndn::Buffer::const_iterator fragBegin, fragEnd;
+  std::tie(fragBegin, fragEnd) = pkt.get<lp::FragmentField>();
+  return Block(&*fragBegin, std::distance(fragBegin, fragEnd)).type();
+}
+
+BOOST_AUTO_TEST_CASE(HoldAndRelease)
+{
+  auto bulkSize = lp::Packet(makeData("/bulk/1")->wireEncode()).wireEncode().size();
+  GenericLinkService::Options options;
+  options.allowEgressScheduling = true;
+  // the bulk flow sends one packet in each round
+  options.egressSchedulerOptions.quantum = bulkSize;
+  initialize(options);
+
+  // transport send queue is above target: packets are held
+  transport->setSendQueueLength(100000);
+  for (int i = 1; i <= 5; ++i) {
+    face->sendData(*makeData("/bulk/" + to_string(i)));
+  }
+  auto ping = makeInterest("/ping/1");
+  BOOST_REQUIRE_LT(lp::Packet(ping->wireEncode()).wireEncode().size(), bulkSize);
+  face->sendInterest(*ping);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressQueued, 6);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutData, 5);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutInterests, 1);
+
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  // transport send queue has drained: the Interest does not wait behind the bulk flow
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 6);
+  BOOST_CHECK_EQUAL(getNetPacketType(transport->sentPackets[0]), tlv::Data);
+  BOOST_CHECK_EQUAL(getNetPacketType(transport->sentPackets[1]), tlv::Interest);
+  for (size_t i = 2; i < 6; ++i) {
+    BOOST_CHECK_EQUAL(getNetPacketType(transport->sentPackets[i]), tlv::Data);
+  }
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressQueued, 0);
+}
+
+BOOST_AUTO_TEST_CASE(PassThrough)
+{
+  GenericLinkService::Options options;
+  options.allowEgressScheduling = true;
+  initialize(options);
+
+  // transport send queue is below target
+  transport->setSendQueueLength(1000);
+  face->sendInterest(*makeInterest("/A"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+
+  // transport cannot report send queue length
+  transport->setSendQueueLength(QUEUE_UNSUPPORTED);
+  face->sendData(*makeData("/B"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressQueued, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  auto interestSize = lp::Packet(makeInterest("/A/1")->wireEncode()).wireEncode().size();
+  GenericLinkService::Options options;
+  options.allowEgressScheduling = true;
+  options.egressSchedulerOptions.capacity = 3 * interestSize;
+  initialize(options);
+
+  std::vector<Interest> droppedInterests;
+  face->onDroppedInterest.connect([&] (const Interest& i) { droppedInterests.push_back(i); });
+
+  transport->setSendQueueLength(100000);
+  for (int i = 1; i <= 4; ++i) {
+    face->sendInterest(*makeInterest("/A/" + to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressQueued, 3);
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressDropped, 1);
+  BOOST_REQUIRE_EQUAL(droppedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(droppedInterests.front().getName(), "/A/1");
+}
+
+BOOST_AUTO_TEST_CASE(DisableFlushes)
+{
+  GenericLinkService::Options options;
+  options.allowEgressScheduling = true;
+  initialize(options);
+
+  transport->setSendQueueLength(100000);
+  face->sendInterest(*makeInterest("/A"));
+  face->sendData(*makeData("/B"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  options.allowEgressScheduling = false;
+  service->setOptions(options);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(service->getCounters().nEgressQueued, 0);
+
+  face->sendInterest(*makeInterest("/C"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EgressScheduling
+
 BOOST_AUTO_TEST_SUITE(LpFields)
 
 BOOST_AUTO_TEST_CASE(ReceiveNextHopFaceId)
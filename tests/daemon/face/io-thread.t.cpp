@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/io-thread.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <future>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestIoThread)
+
+BOOST_AUTO_TEST_CASE(Post)
+{
+  IoThread thread(3);
+  BOOST_CHECK_EQUAL(thread.getIndex(), 3);
+  BOOST_CHECK_EQUAL(thread.isCurrentThread(), false);
+
+  std::promise<bool> isOnIoThread;
+  thread.getIoService().post([&] { isOnIoThread.set_value(thread.isCurrentThread()); });
+  BOOST_CHECK_EQUAL(isOnIoThread.get_future().get(), true);
+}
+
+BOOST_AUTO_TEST_CASE(PendingHandlersRunBeforeJoin)
+{
+  int nInvoked = 0;
+  {
+    IoThread thread;
+    for (int i = 0; i < 10; ++i) {
+      thread.getIoService().post([&nInvoked] { ++nInvoked; });
+    }
+  }
+  BOOST_CHECK_EQUAL(nInvoked, 10);
+}
+
+BOOST_AUTO_TEST_CASE(Pool)
+{
+  IoThreadPool pool(2);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+
+  auto t0 = pool.next();
+  auto t1 = pool.next();
+  auto t2 = pool.next();
+  BOOST_CHECK_EQUAL(t0->getIndex(), 0);
+  BOOST_CHECK_EQUAL(t1->getIndex(), 1);
+  BOOST_CHECK(t2 == t0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestIoThread
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -137,6 +137,25 @@ BOOST_AUTO_TEST_CASE(SendQueueLength)
   BOOST_CHECK_EQUAL(transport->getSendQueueLength(), QUEUE_UNSUPPORTED);
 }
 
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(PacketMmap)
+{
+  SKIP_IF_NO_RUNNING_ETHERNET_NETIF();
+  initializeMulticast(getRunningNetif(), ndn::nfd::LINK_TYPE_MULTI_ACCESS,
+                      {0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e}, EthernetIoBackend::PACKET_MMAP);
+
+  checkStaticPropertiesInitialized(*transport);
+  BOOST_CHECK_EQUAL(transport->getRemoteUri(), FaceUri("ether://[" + remoteEp.toString() + "]"));
+  BOOST_REQUIRE_EQUAL(transport->getState(), TransportState::UP);
+
+  transport->send(ndn::encoding::makeStringBlock(300, "hello"));
+  transport->send(ndn::encoding::makeStringBlock(301, "world!"));
+  limitedIo.defer(100_ms);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 2);
+}
+#endif // __linux__
+
 BOOST_AUTO_TEST_SUITE_END() // TestMulticastEthernetTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/receive-buffer-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestReceiveBufferPool)
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+  ReceiveBufferPool pool(1000, 2);
+  BOOST_CHECK_EQUAL(pool.getBufferSize(), 1000);
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 0);
+
+  auto b1 = pool.acquire();
+  auto b2 = pool.acquire();
+  auto b3 = pool.acquire();
+  BOOST_CHECK_EQUAL(b1->size(), 1000);
+  BOOST_CHECK_EQUAL(pool.getNAllocations(), 3);
+
+  const ndn::Buffer* p1 = b1.get();
+  b1.reset();
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 1);
+  b2.reset();
+  b3.reset(); // exceeds maxIdleBuffers, deallocated
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 2);
+
+  auto b4 = pool.acquire();
+  auto b5 = pool.acquire();
+  BOOST_CHECK_EQUAL(pool.getNAllocations(), 3);
+  BOOST_CHECK(b4.get() == p1 || b5.get() == p1);
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SharedWithBlock)
+{
+  ReceiveBufferPool pool(100, 1);
+  auto buffer = pool.acquire();
+  auto pkt = ndn::encoding::makeStringBlock(300, "hello");
+  std::copy(pkt.begin(), pkt.end(), buffer->begin());
+
+  bool isOk = false;
+  Block block;
+  std::tie(isOk, block) = Block::fromBuffer(buffer, 0);
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK(block.wire() == buffer->data());
+
+  buffer.reset();
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 0);
+  BOOST_CHECK(block == pkt);
+
+  block = Block();
+  BOOST_CHECK_EQUAL(pool.getNIdleBuffers(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(OutlivePool)
+{
+  auto pool = make_unique<ReceiveBufferPool>(100, 1);
+  auto buffer = pool->acquire();
+  pool.reset();
+  buffer.reset(); // must not access the destroyed pool
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestReceiveBufferPool
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
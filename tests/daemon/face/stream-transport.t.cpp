@@ -70,6 +70,40 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBatch, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // the first packet is written alone, the others are gathered while that write is in progress,
+  // and they exceed the size of a single batch
+  std::vector<Block> blocks;
+  size_t nBytes = 0;
+  for (int i = 0; i < 100; ++i) {
+    blocks.push_back(ndn::encoding::makeStringBlock(300, std::string(1000 + i, 'a' + i % 26)));
+    this->transport->send(blocks.back());
+    nBytes += blocks.back().size();
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, 100);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, nBytes);
+  BOOST_CHECK_GT(this->transport->getSendQueueLength(), 0);
+
+  std::vector<uint8_t> readBuf(nBytes);
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+
+  auto it = readBuf.begin();
+  for (const auto& block : blocks) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(it, it + block.size(), block.begin(), block.end());
+    it += block.size();
+  }
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -137,6 +171,80 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveMultipleBlocks, T, StreamTransportFixtur
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveRetainsDecodedBlocks, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // received blocks refer to the receive buffer, which must not be overwritten afterwards
+  auto pkt1 = ndn::encoding::makeStringBlock(300, "hello");
+  auto pkt2 = ndn::encoding::makeStringBlock(301, "world");
+  auto pkt3 = ndn::encoding::makeStringBlock(302, "again");
+  ndn::Buffer buf1(pkt1.begin(), pkt1.end());
+  buf1.insert(buf1.end(), pkt2.begin(), pkt2.end() - 2);
+  ndn::Buffer buf2(pkt2.end() - 2, pkt2.end());
+  buf2.insert(buf2.end(), pkt3.begin(), pkt3.end());
+
+  this->remoteWrite(buf1);
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), 1);
+
+  this->remoteWrite(buf2);
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), 3);
+  BOOST_CHECK(this->receivedPackets->at(0).packet == pkt1);
+  BOOST_CHECK(this->receivedPackets->at(1).packet == pkt2);
+  BOOST_CHECK(this->receivedPackets->at(2).packet == pkt3);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceivePartialInPlace, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // a partial packet that fits in the rest of the receive buffer is completed in place
+  std::vector<uint8_t> bytes(ndn::MAX_NDN_PACKET_SIZE - 4);
+  auto pkt = ndn::encoding::makeBinaryBlock(300, bytes.data(), bytes.size());
+  ndn::Buffer buf1(pkt.begin(), pkt.end());
+  buf1.insert(buf1.end(), pkt.begin(), pkt.begin() + 1000);
+  ndn::Buffer buf2(pkt.begin() + 1000, pkt.end());
+
+  this->remoteWrite(buf1);
+  this->remoteWrite(buf2);
+
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), 2);
+  BOOST_CHECK(this->receivedPackets->at(1).packet == pkt);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytesCopied, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceivePartialMoved, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // a partial packet that does not fit in the rest of the receive buffer is moved to a
+  // fresh buffer, because the packets decoded from the current one are still referenced
+  std::vector<uint8_t> bytes(ndn::MAX_NDN_PACKET_SIZE - 4);
+  auto large = ndn::encoding::makeBinaryBlock(300, bytes.data(), bytes.size());
+  auto small = ndn::encoding::makeStringBlock(301, "hello");
+  ndn::Buffer buf1;
+  size_t nPackets = 0;
+  while (buf1.size() + small.size() + large.size() <= STREAM_RECEIVE_BUFFER_SIZE) {
+    buf1.insert(buf1.end(), large.begin(), large.end());
+    ++nPackets;
+  }
+  buf1.insert(buf1.end(), small.begin(), small.end());
+  ++nPackets;
+  buf1.insert(buf1.end(), large.begin(), large.begin() + 1000);
+  ndn::Buffer buf2(large.begin() + 1000, large.end());
+
+  this->remoteWrite(buf1);
+  BOOST_CHECK_EQUAL(this->receivedPackets->size(), nPackets);
+  this->remoteWrite(buf2);
+
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), nPackets + 1);
+  BOOST_CHECK(this->receivedPackets->back().packet == large);
+  BOOST_CHECK_GT(this->transport->getCounters().nInBytesCopied, 0);
+  BOOST_CHECK_LE(this->transport->getCounters().nInBytesCopied, 1000);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveTooLarge, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -233,6 +341,75 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueLength, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueLimit, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // the first packet is written right away, the others wait in the send queue
+  this->transport->setSendQueueLimit(5000);
+  for (int i = 0; i < 100; ++i) {
+    this->transport->send(ndn::encoding::makeStringBlock(300, std::string(1000, 'a')));
+  }
+  const auto& counters = this->transport->getCounters();
+  BOOST_CHECK_GT(counters.nOutQueueOverflow, 0);
+
+  this->limitedIo.defer(100_ms);
+  BOOST_CHECK_EQUAL(counters.nOutQueueDequeued + counters.nOutQueueOverflow, 100);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CodelDrop, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // every packet that has waited in the queue is above target
+  Codel::Options options;
+  options.target = 0_ns;
+  options.interval = 1_ns;
+  options.minQueueBytes = 0;
+  this->transport->enableCodel(options, false);
+  BOOST_REQUIRE(this->transport->getCodel() != nullptr);
+
+  for (int i = 0; i < 100; ++i) {
+    this->transport->send(ndn::encoding::makeStringBlock(300, std::string(1000, 'a')));
+  }
+
+  this->limitedIo.defer(100_ms);
+  const auto& counters = this->transport->getCounters();
+  BOOST_CHECK_GT(counters.nOutCodelDropped, 0);
+  BOOST_CHECK_EQUAL(counters.nOutQueueDequeued + counters.nOutCodelDropped, 100);
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), 0);
+
+  std::map<std::string, uint64_t> extendedCounters;
+  this->transport->reportExtendedCounters([&] (const std::string& name, uint64_t value) {
+    extendedCounters[name] = value;
+  });
+  BOOST_CHECK_EQUAL(extendedCounters.at("nOutCodelDropped"), counters.nOutCodelDropped);
+  BOOST_CHECK_EQUAL(extendedCounters.at("nOutQueueDequeued"), counters.nOutQueueDequeued);
+  BOOST_CHECK_EQUAL(extendedCounters.at("outQueueSojournTime"), counters.outQueueSojournTime);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CodelBypassed, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // the link service marks congestion, so CoDel stands aside
+  Codel::Options options;
+  options.target = 0_ns;
+  options.interval = 1_ns;
+  options.minQueueBytes = 0;
+  this->transport->enableCodel(options, true);
+
+  for (int i = 0; i < 100; ++i) {
+    this->transport->send(ndn::encoding::makeStringBlock(300, std::string(1000, 'a')));
+  }
+
+  this->limitedIo.defer(100_ms);
+  const auto& counters = this->transport->getCounters();
+  BOOST_CHECK_EQUAL(counters.nOutCodelDropped, 0);
+  BOOST_CHECK_EQUAL(counters.nOutQueueDequeued, 100);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStreamTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
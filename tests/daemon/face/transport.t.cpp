@@ -178,7 +178,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(SetState, T, AllStateTransitions)
   }
 }
 
-class DummyTransportFixture : public GlobalIoFixture
+class DummyTransportFixture : public GlobalIoTimeFixture
 {
 protected:
   void
@@ -245,6 +245,59 @@ BOOST_FIXTURE_TEST_CASE(Receive, DummyTransportFixture)
   BOOST_CHECK(receivedPackets->at(2).packet == pkt3);
 }
 
+BOOST_FIXTURE_TEST_CASE(EstimateSendQueueLength, DummyTransportFixture)
+{
+  this->initialize();
+  Block pkt = ndn::encoding::makeStringBlock(300, "Lorem ipsum dolor sit amet,");
+
+  // sampling disabled: every estimate reads the queue length
+  transport->setSendQueueLength(1000);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 1000);
+  transport->setSendQueueLength(2000);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 2000);
+
+  transport->setSendQueueSamplingInterval(10_ms);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 2000);
+
+  // within the interval, the estimate adds the octets sent since the sample
+  transport->setSendQueueLength(0);
+  transport->send(pkt);
+  transport->send(pkt);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000),
+                    static_cast<ssize_t>(2000 + 2 * pkt.size()));
+
+  // an estimate crossing the threshold is confirmed with a new sample
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(2000), 0);
+  transport->send(pkt);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), static_cast<ssize_t>(pkt.size()));
+
+  // at most one confirming sample is taken per interval
+  transport->setSendQueueLength(1);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(2), static_cast<ssize_t>(pkt.size()));
+  transport->send(pkt);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(2), static_cast<ssize_t>(2 * pkt.size()));
+
+  // the sample is refreshed after the interval
+  this->advanceClocks(10_ms);
+  transport->setSendQueueLength(6000);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 6000);
+
+  // a sample above the threshold is trusted until the interval elapses
+  transport->setSendQueueLength(100);
+  transport->send(pkt);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000),
+                    static_cast<ssize_t>(6000 + pkt.size()));
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 100);
+
+  // errors are not cached
+  transport->setSendQueueLength(QUEUE_ERROR);
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), QUEUE_ERROR);
+  transport->setSendQueueLength(300);
+  BOOST_CHECK_EQUAL(transport->estimateSendQueueLength(5000), 300);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
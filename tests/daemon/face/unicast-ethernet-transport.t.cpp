@@ -177,6 +177,48 @@ BOOST_AUTO_TEST_CASE(SendQueueLength)
   BOOST_CHECK_EQUAL(transport->getSendQueueLength(), QUEUE_UNSUPPORTED);
 }
 
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(PacketMmap)
+{
+  SKIP_IF_NO_RUNNING_ETHERNET_NETIF();
+  initializeUnicast(getRunningNetif(), ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                    {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e}, EthernetIoBackend::PACKET_MMAP);
+
+  checkStaticPropertiesInitialized(*transport);
+  BOOST_CHECK_EQUAL(transport->getLocalUri(), FaceUri("dev://" + localEp));
+  BOOST_CHECK_EQUAL(transport->getRemoteUri(), FaceUri("ether://[" + remoteEp.toString() + "]"));
+  BOOST_REQUIRE_EQUAL(transport->getState(), TransportState::UP);
+
+  // more frames than the transmit ring can hold, including one shorter than the minimum payload
+  transport->send(ndn::encoding::makeEmptyBlock(300));
+  for (int i = 0; i < 100; ++i) {
+    transport->send(ndn::encoding::makeStringBlock(300, std::string(1000, 'x')));
+  }
+  limitedIo.defer(100_ms);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 101);
+
+  std::map<std::string, uint64_t> counters;
+  transport->reportExtendedCounters([&] (const std::string& name, uint64_t value) {
+    counters[name] = value;
+  });
+  BOOST_REQUIRE_EQUAL(counters.count("packetRing/nOutQueued"), 1);
+  BOOST_REQUIRE_EQUAL(counters.count("packetRing/nOutDrops"), 1);
+  // the scheduled flush has handed every queued frame to the kernel
+  BOOST_CHECK_EQUAL(counters["packetRing/nOutQueued"], 0);
+  // frames are dropped only when the ring is full and the kernel cannot take the queued
+  // frames, therefore at least a ring's worth of the first frames went out
+  BOOST_CHECK_LE(counters["packetRing/nOutDrops"], 101 - 64);
+
+  transport->afterStateChange.connect([this] (auto, auto newState) {
+    if (newState == TransportState::CLOSED)
+      this->limitedIo.afterOp();
+  });
+  transport->close();
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+}
+#endif // __linux__
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnicastEthernetTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -53,7 +53,10 @@ protected:
 
   void
   initialize(ip::address address,
-             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT)
+             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+             size_t receiveBatchSize = 1,
+             size_t sendBatchSize = 1,
+             shared_ptr<IoThread> ioThread = nullptr)
   {
     udp::socket sock(g_io);
     sock.connect(udp::endpoint(address, 7070));
@@ -62,7 +65,10 @@ protected:
     remoteConnect(address);
 
     face = make_unique<Face>(make_unique<DummyLinkService>(),
-                             make_unique<UnicastUdpTransport>(std::move(sock), persistency, 3_s));
+                             make_unique<UnicastUdpTransport>(std::move(sock), persistency, 3_s,
+                                                                               receiveBatchSize,
+                                                                               sendBatchSize,
+                                                                               std::move(ioThread)));
     transport = static_cast<UnicastUdpTransport*>(face->getTransport());
     receivedPackets = &static_cast<DummyLinkService*>(face->getLinkService())->receivedPackets;
 
@@ -105,6 +105,139 @@ BOOST_AUTO_TEST_CASE(IdleClose)
   BOOST_CHECK_EQUAL(nStateChanges, 2);
 }
 
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(ReceiveBatch)
+{
+  TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 8);
+  BOOST_CHECK_EQUAL(transport->getReceiveBatchSize(), 8);
+
+  uint64_t nBurstsBegun = 0;
+  uint64_t nBurstsEnded = 0;
+  transport->beforeReceiveBurst.connect([&] {
+    BOOST_CHECK_EQUAL(nBurstsBegun, nBurstsEnded);
+    ++nBurstsBegun;
+  });
+  transport->afterReceiveBurst.connect([&] { ++nBurstsEnded; });
+
+  std::vector<Block> pkts;
+  for (int i = 0; i < 3; ++i) {
+    pkts.push_back(ndn::encoding::makeStringBlock(300, "hello" + to_string(i)));
+    remoteSocket.send(boost::asio::buffer(pkts.back().wire(), pkts.back().size()));
+  }
+  limitedIo.defer(1_s);
+
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), 3);
+  for (size_t i = 0; i < pkts.size(); ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == pkts[i]);
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+
+  const auto& batches = transport->getCounters().nReceiveBatches;
+  uint64_t nBatches = 0;
+  for (const auto& bucket : batches) {
+    nBatches += bucket;
+  }
+  BOOST_CHECK_GE(nBatches, 1);
+  BOOST_CHECK_LE(nBatches, 3);
+  BOOST_CHECK_EQUAL(batches.back(), 0);
+  // a read that returns more than one datagram is signaled as a burst
+  BOOST_CHECK_EQUAL(nBurstsBegun, nBatches - batches[0]);
+  BOOST_CHECK_EQUAL(nBurstsEnded, nBurstsBegun);
+
+  std::map<std::string, uint64_t> reported;
+  transport->reportExtendedCounters([&] (const std::string& name, uint64_t value) {
+    reported[name] = value;
+  });
+  BOOST_CHECK_EQUAL(reported.size(), batches.size() + 2);
+  BOOST_CHECK_EQUAL(reported.at("nReceiveBatches/1"), batches[0]);
+  BOOST_CHECK_EQUAL(reported.at("nReceiveBatches/2"), batches[1]);
+  BOOST_CHECK_EQUAL(reported.at("nInRingDrops"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SendBatch)
+{
+  TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 1, 4);
+  BOOST_CHECK_EQUAL(transport->getSendBatchSize(), 4);
+
+  std::vector<Block> pkts;
+  size_t nBytes = 0;
+  for (int i = 0; i < 3; ++i) {
+    pkts.push_back(ndn::encoding::makeStringBlock(300, "hello" + to_string(i)));
+    nBytes += pkts.back().size();
+    transport->send(pkts.back());
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutBytes, nBytes);
+  // packets are held until the end of the current io_service turn
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), static_cast<ssize_t>(nBytes));
+
+  for (const auto& pkt : pkts) {
+    std::vector<uint8_t> readBuf(pkt.size());
+    remoteRead(readBuf);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), pkt.begin(), pkt.end());
+  }
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), 0);
+
+  // a full batch is flushed without waiting for the end of the io_service turn
+  for (int i = 0; i < 4; ++i) {
+    transport->send(pkts.front());
+  }
+  for (int i = 0; i < 4; ++i) {
+    std::vector<uint8_t> readBuf(pkts.front().size());
+    remoteRead(readBuf);
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 7);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+#endif // __linux__
+
+BOOST_AUTO_TEST_CASE(OffloadedIo)
+{
+  auto ioThread = make_shared<IoThread>();
+  TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 1, 1, ioThread);
+  BOOST_CHECK(transport->getIoThread() == ioThread);
+
+  // datagrams are received on the I/O thread, and delivered on this thread
+  std::vector<Block> pkts;
+  for (int i = 0; i < 3; ++i) {
+    pkts.push_back(ndn::encoding::makeStringBlock(300, "hello" + to_string(i)));
+    remoteSocket.send(boost::asio::buffer(pkts.back().wire(), pkts.back().size()));
+  }
+  limitedIo.defer(1_s);
+
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), 3);
+  for (size_t i = 0; i < pkts.size(); ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == pkts[i]);
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nInRingDrops, 0);
+
+  // packets are sent on the I/O thread
+  for (const auto& pkt : pkts) {
+    transport->send(pkt);
+  }
+  for (const auto& pkt : pkts) {
+    std::vector<uint8_t> readBuf(pkt.size());
+    remoteRead(readBuf);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), pkt.begin(), pkt.end());
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutRingDrops, 0);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+
+  // the transport becomes CLOSED after the I/O thread has closed its socket
+  transport->afterStateChange.connect([this] (auto, auto newState) {
+    if (newState == TransportState::CLOSED) {
+      limitedIo.afterOp();
+    }
+  });
+  transport->close();
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::CLOSING);
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::CLOSED);
+}
+
 using RemoteCloseFixture = IpTransportFixture<UnicastUdpTransportFixture,
                                               AddressFamily::Any, AddressScope::Loopback>;
 using RemoteClosePersistencies = boost::mpl::vector_c<ndn::nfd::FacePersistency,
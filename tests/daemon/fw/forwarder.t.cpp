@@ -29,6 +29,7 @@
 #include "tests/test-common.hpp"
 #include "tests/daemon/global-io-fixture.hpp"
 #include "tests/daemon/face/dummy-face.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
 #include "choose-strategy.hpp"
 #include "dummy-strategy.hpp"
 
@@ -98,6 +99,92 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(forwarder.getCounters().nUnsolicitedData, 0);
 }
 
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+  auto face3 = addFace();
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face3, 0);
+
+  std::vector<Forwarder::IncomingPacket> batch;
+  for (int i = 0; i < 10; ++i) {
+    batch.push_back({FaceEndpoint(*face1, 0), makeInterest("/A/" + to_string(i), false, nullopt, 1000 + i),
+                     nullptr});
+  }
+  // duplicate Nonce on another face is detected as a loop, because the first Interest
+  // has been processed to completion
+  batch.push_back({FaceEndpoint(*face2, 0), makeInterest("/A/0", false, nullopt, 1000), nullptr});
+  // Data in the same batch satisfy the Interests before them
+  for (int i = 0; i < 5; ++i) {
+    batch.push_back({FaceEndpoint(*face3, 0), nullptr, makeData("/A/" + to_string(i))});
+  }
+
+  forwarder.startProcessBatch(batch);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 11);
+  BOOST_REQUIRE_EQUAL(face3->sentInterests.size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(face3->sentInterests[i].getName(), "/A/" + to_string(i));
+  }
+  BOOST_REQUIRE_EQUAL(face2->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentNacks.back().getReason(), lp::NackReason::DUPLICATE);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, 5);
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 5);
+  BOOST_CHECK_EQUAL(face1->sentData.back().getName(), "/A/4");
+
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nSatisfiedInterests, 5);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveBurst)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+  auto transport1 = static_cast<face::tests::DummyTransport*>(face1->getTransport());
+  auto transport2 = static_cast<face::tests::DummyTransport*>(face2->getTransport());
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  // Interests received during a burst are processed when the burst ends
+  transport1->beginReceiveBurst();
+  face1->receiveInterest(*makeInterest("/A/1", false, nullopt, 1001), 0);
+  face1->receiveInterest(*makeInterest("/A/2", false, nullopt, 1002), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 0);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 0);
+  transport1->endReceiveBurst();
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face2->sentInterests[0].getName(), "/A/1");
+  BOOST_CHECK_EQUAL(face2->sentInterests[1].getName(), "/A/2");
+
+  // a Nack is processed after the packets received before it
+  transport2->beginReceiveBurst();
+  face2->receiveData(*makeData("/A/1"), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, 0);
+  face2->receiveNack(makeNack(face2->sentInterests[1], lp::NackReason::NO_ROUTE), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInNacks, 1);
+  transport2->endReceiveBurst();
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentData[0].getName(), "/A/1");
+  BOOST_REQUIRE_EQUAL(face1->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentNacks[0].getInterest().getName(), "/A/2");
+
+  // bursts on different faces may be nested
+  transport1->beginReceiveBurst();
+  transport2->beginReceiveBurst();
+  face1->receiveInterest(*makeInterest("/A/3", false, nullopt, 1003), 0);
+  transport2->endReceiveBurst();
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 2);
+  transport1->endReceiveBurst();
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 3);
+}
+
 BOOST_AUTO_TEST_CASE(CsMatched)
 {
   auto face1 = addFace();
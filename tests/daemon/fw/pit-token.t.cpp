@@ -86,6 +86,56 @@ BOOST_FIXTURE_TEST_CASE(Downstream, GlobalIoTimeFixture)
   BOOST_CHECK(tokenD1 == tokenI1);
 }
 
+// Router issues PIT tokens to upstream.
+BOOST_FIXTURE_TEST_CASE(Upstream, GlobalIoTimeFixture)
+{
+  TopologyTester topo;
+  TopologyNode nodeR = topo.addForwarder("R");
+  Forwarder& forwarderR = topo.getForwarder(nodeR);
+  forwarderR.setPitTokenIssuingEnabled(true);
+  auto linkC = topo.addBareLink("C", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkS = topo.addBareLink("S", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  topo.registerPrefix(nodeR, linkS->getForwarderFace(), "/U", 5);
+  // Client --- Router --- Server
+  // Client does not use PIT token; Router issues PIT token; Server returns PIT token.
+
+  // C sends Interest /U/0 without PIT token
+  linkC->receivePacket(makeInterest("/U/0", false, nullopt, 1)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // S should receive Interest with a PIT token issued by R
+  BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 1);
+  lp::Packet lppS(linkS->sentPackets.back());
+  BOOST_REQUIRE_EQUAL(lppS.count<lp::PitTokenField>(), 1);
+  lp::PitToken tokenS(lppS.get<lp::PitTokenField>());
+  auto pitEntry = forwarderR.getPit().findByToken(tokenS);
+  BOOST_REQUIRE(pitEntry != nullptr);
+  BOOST_CHECK_EQUAL(pitEntry->getName(), "/U/0");
+
+  // S responds Data with the PIT token
+  lp::Packet lppD(makeData("/U/0")->wireEncode());
+  lppD.add<lp::PitTokenField>(lppS.get<lp::PitTokenField>());
+  linkS->receivePacket(lppD.wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // C should receive Data without PIT token, and the PIT entry is gone
+  BOOST_REQUIRE_EQUAL(linkC->sentPackets.size(), 1);
+  lp::Packet lppC(linkC->sentPackets.back());
+  BOOST_CHECK_EQUAL(lppC.count<lp::PitTokenField>(), 0);
+  BOOST_CHECK_EQUAL(forwarderR.getPit().size(), 0);
+  BOOST_CHECK(forwarderR.getPit().findByToken(tokenS) == nullptr);
+
+  // a stale PIT token does not prevent the name lookup
+  linkC->receivePacket(makeInterest("/U/1", false, nullopt, 2)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+  BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 2);
+  lp::Packet lppD1(makeData("/U/1")->wireEncode());
+  lppD1.add<lp::PitTokenField>(lppS.get<lp::PitTokenField>());
+  linkS->receivePacket(lppD1.wireEncode());
+  advanceClocks(5_ms, 30_ms);
+  BOOST_CHECK_EQUAL(linkC->sentPackets.size(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPitToken
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
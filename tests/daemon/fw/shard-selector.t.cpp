@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/shard-selector.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_AUTO_TEST_SUITE(TestShardSelector)
+
+BOOST_AUTO_TEST_CASE(SingleShard)
+{
+  ShardSelector select(1, 2);
+  BOOST_CHECK_EQUAL(select.getNShards(), 1);
+  BOOST_CHECK_EQUAL(select.getPrefixLength(), 2);
+  BOOST_CHECK_EQUAL(select("/"), 0);
+  BOOST_CHECK_EQUAL(select("/A/B/C"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SamePrefix)
+{
+  ShardSelector select(8, 2);
+
+  size_t shard = select("/A/B");
+  BOOST_CHECK_LT(shard, 8);
+  BOOST_CHECK_EQUAL(select("/A/B/C"), shard);
+  BOOST_CHECK_EQUAL(select("/A/B/C/D/E"), shard);
+
+  // Data satisfying an Interest named with an implicit digest
+  auto data = makeData("/A");
+  BOOST_CHECK_EQUAL(select(data->getFullName()), select(data->getName()));
+  data = makeData("/A/B/C");
+  BOOST_CHECK_EQUAL(select(data->getFullName()), shard);
+}
+
+BOOST_AUTO_TEST_CASE(Distribution)
+{
+  const size_t nShards = 4;
+  const size_t nNames = 4000;
+  ShardSelector select(nShards, 1);
+
+  std::vector<size_t> counts(nShards);
+  for (size_t i = 0; i < nNames; ++i) {
+    size_t shard = select(Name("/prefix").appendNumber(i).append("suffix"));
+    BOOST_REQUIRE_LT(shard, nShards);
+    ++counts[shard];
+  }
+  // all names have the same first component
+  BOOST_CHECK_EQUAL(*std::max_element(counts.begin(), counts.end()), nNames);
+
+  std::fill(counts.begin(), counts.end(), 0);
+  select = ShardSelector(nShards, 2);
+  for (size_t i = 0; i < nNames; ++i) {
+    ++counts[select(Name("/prefix").appendNumber(i).append("suffix"))];
+  }
+  for (size_t count : counts) {
+    BOOST_CHECK_GT(count, nNames / nShards / 2);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShardSelector
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -24,11 +24,15 @@
  */
 
 #include "mgmt/cs-manager.hpp"
+#include "mgmt/status-counter.hpp"
+#include "table/cs-disk-store.hpp"
 
 #include "manager-common-fixture.hpp"
 
 #include <ndn-cxx/mgmt/nfd/cs-info.hpp>
 
+#include <boost/filesystem.hpp>
+
 namespace nfd {
 namespace tests {
 
@@ -223,6 +227,36 @@ BOOST_AUTO_TEST_CASE(Info)
   BOOST_CHECK_EQUAL(info.getNMisses(), 1493);
 }
 
+BOOST_AUTO_TEST_CASE(Counters)
+{
+  auto dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-manager-disk";
+  m_cs.setLimit(1);
+  m_cs.setByteLimit(1000000);
+  m_cs.setDiskStore(make_unique<cs::DiskStore>(dir, 8192, 4096));
+  m_cs.insert(*makeData("/A"));
+  m_cs.insert(*makeData("/B")); // evicts /A to the disk tier
+
+  receiveInterest(*makeInterest("/localhost/nfd/cs/counters", true));
+  Block dataset = concatenateResponses();
+  dataset.parse();
+  std::map<std::string, uint64_t> counters;
+  for (const auto& element : dataset.elements()) {
+    StatusCounter counter(element);
+    counters[counter.getKey()] = counter.getValue();
+  }
+
+  BOOST_CHECK_EQUAL(counters["nBytes"], m_cs.getNBytes());
+  BOOST_CHECK_GT(counters["nBytes"], 0);
+  BOOST_CHECK_EQUAL(counters["byteLimit"], 1000000);
+  BOOST_CHECK_EQUAL(counters["disk/capacity"], 8192);
+  BOOST_CHECK_EQUAL(counters["disk/nEntries"], 1);
+  BOOST_CHECK_EQUAL(counters["disk/nBytes"], m_cs.getDiskStore()->getNBytes());
+  BOOST_CHECK_GT(counters["disk/nBytes"], 0);
+
+  m_cs.setDiskStore(nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
@@ -719,6 +719,54 @@ BOOST_AUTO_TEST_CASE(UpdateCongestionMarkingEnableDisable)
   });
 }
 
+BOOST_AUTO_TEST_CASE(UpdateEgressSchedulingEnableDisable)
+{
+  createFace("udp4://127.0.0.1:26363");
+
+  ControlParameters enableParams;
+  enableParams.setFaceId(faceId);
+  enableParams.setFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED, true);
+
+  ControlParameters disableParams;
+  disableParams.setFaceId(faceId);
+  disableParams.setFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED, false);
+
+  updateFace(enableParams, false, [] (const ControlResponse& actual) {
+    BOOST_CHECK_EQUAL(actual.getCode(), 200);
+    BOOST_TEST_MESSAGE(actual.getText());
+
+    if (actual.getBody().hasWire()) {
+      ControlParameters actualParams(actual.getBody());
+      BOOST_REQUIRE(actualParams.hasFlags());
+      BOOST_CHECK(actualParams.getFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED));
+    }
+    else {
+      BOOST_ERROR("Enable: Response does not contain ControlParameters");
+    }
+  });
+
+  auto linkService = dynamic_cast<face::GenericLinkService*>(
+    node1.faceTable.get(faceId)->getLinkService());
+  BOOST_REQUIRE(linkService != nullptr);
+  BOOST_CHECK(linkService->getOptions().allowEgressScheduling);
+
+  updateFace(disableParams, false, [] (const ControlResponse& actual) {
+    BOOST_CHECK_EQUAL(actual.getCode(), 200);
+    BOOST_TEST_MESSAGE(actual.getText());
+
+    if (actual.getBody().hasWire()) {
+      ControlParameters actualParams(actual.getBody());
+      BOOST_REQUIRE(actualParams.hasFlags());
+      BOOST_CHECK(!actualParams.getFlagBit(FaceManager::BIT_EGRESS_SCHEDULING_ENABLED));
+    }
+    else {
+      BOOST_ERROR("Disable: Response does not contain ControlParameters");
+    }
+  });
+
+  BOOST_CHECK(!linkService->getOptions().allowEgressScheduling);
+}
+
 BOOST_AUTO_TEST_CASE(SelfUpdating)
 {
   createFace();
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/face-manager.hpp"
+#include "mgmt/status-counter.hpp"
 #include "face/protocol-factory.hpp"
 
 #include "manager-common-fixture.hpp"
@@ -335,6 +336,38 @@ BOOST_AUTO_TEST_CASE(ChannelDataset)
   }
 }
 
+BOOST_AUTO_TEST_CASE(CounterDataset)
+{
+  auto face1 = addFace(REMOVE_LAST_NOTIFICATION);
+  auto face2 = addFace(REMOVE_LAST_NOTIFICATION);
+  addFace(REMOVE_LAST_NOTIFICATION); // reports no extended counters
+  auto transport1 = static_cast<face::tests::DummyTransport*>(face1->getTransport());
+  transport1->extendedCounters["nReceiveBatches/1"] = 5;
+  transport1->extendedCounters["nInRingDrops"] = 0;
+  auto transport2 = static_cast<face::tests::DummyTransport*>(face2->getTransport());
+  transport2->extendedCounters["nOutCodelDropped"] = 7;
+
+  receiveInterest(Interest("/localhost/nfd/faces/counters").setCanBePrefix(true));
+
+  Block content = concatenateResponses();
+  content.parse();
+  std::set<std::pair<std::string, uint64_t>> counters;
+  for (const auto& element : content.elements()) {
+    StatusCounter counter(element);
+    counters.emplace(counter.getKey(), counter.getValue());
+  }
+
+  std::string id1 = to_string(face1->getId());
+  std::string id2 = to_string(face2->getId());
+  std::set<std::pair<std::string, uint64_t>> expected{
+    {id1 + "/nReceiveBatches/1", 5},
+    {id1 + "/nInRingDrops", 0},
+    {id2 + "/nOutCodelDropped", 7},
+  };
+  BOOST_CHECK(counters == expected);
+  BOOST_CHECK_EQUAL(content.elements().size(), expected.size());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Datasets
 
 BOOST_AUTO_TEST_SUITE(Notifications)
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "mgmt/status-counter.hpp"
 #include "core/version.hpp"
 
 #include "manager-common-fixture.hpp"
@@ -108,6 +109,31 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
 }
 
+BOOST_AUTO_TEST_CASE(PitStatusDataset)
+{
+  Pit& pit = m_forwarder.getPit();
+  for (int i = 0; i < 10; ++i) {
+    pit.insert(*makeInterest(Name("/pit").appendNumber(i)));
+  }
+
+  receiveInterest(Interest("/localhost/nfd/status/pit").setCanBePrefix(true));
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  std::map<std::string, uint64_t> counters;
+  for (const auto& element : content.elements()) {
+    StatusCounter counter(element);
+    counters[counter.getKey()] = counter.getValue();
+  }
+
+  BOOST_CHECK_EQUAL(counters.size(), 4);
+  BOOST_CHECK_EQUAL(counters["nEntries"], 10);
+  BOOST_CHECK_EQUAL(counters["entrySize"], pit.getEntrySize());
+  BOOST_CHECK_EQUAL(counters["nReservedBytes"], pit.getNReservedBytes());
+  BOOST_CHECK_EQUAL(counters["nReservedBytesPerEntry"], pit.getNReservedBytes() / 10);
+  BOOST_CHECK_GE(counters["nReservedBytesPerEntry"], pit.getEntrySize());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mgmt/status-counter.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_AUTO_TEST_SUITE(TestStatusCounter)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  StatusCounter counter("257/nReceiveBatches/4", 42);
+  BOOST_CHECK_EQUAL(counter.getKey(), "257/nReceiveBatches/4");
+  BOOST_CHECK_EQUAL(counter.getValue(), 42);
+
+  Block wire = counter.wireEncode();
+  BOOST_CHECK_EQUAL(wire.type(), tlv::StatusCounter);
+
+  StatusCounter decoded(wire);
+  BOOST_CHECK_EQUAL(decoded, counter);
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(decoded), "257/nReceiveBatches/4=42");
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  Block wrongType(tlv::StatusCounterKey);
+  wrongType.encode();
+  BOOST_CHECK_THROW(StatusCounter{wrongType}, tlv::Error);
+
+  Block missingValue(tlv::StatusCounter);
+  missingValue.push_back(ndn::encoding::makeStringBlock(tlv::StatusCounterKey, "k"));
+  missingValue.encode();
+  BOOST_CHECK_THROW(StatusCounter{missingValue}, tlv::Error);
+
+  Block missingKey(tlv::StatusCounter);
+  missingKey.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::StatusCounterValue, 1));
+  missingKey.encode();
+  BOOST_CHECK_THROW(StatusCounter{missingKey}, tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestStatusCounter
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace tests
+} // namespace nfd
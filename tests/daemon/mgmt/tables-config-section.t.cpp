@@ -33,6 +33,9 @@
 #include "tests/daemon/global-io-fixture.hpp"
 #include "tests/daemon/fw/dummy-strategy.hpp"
 
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
 namespace nfd {
 namespace tests {
 
@@ -155,6 +158,66 @@ BOOST_AUTO_TEST_CASE(InvalidValue)
 
 BOOST_AUTO_TEST_SUITE_END() // CsMaxPackets
 
+BOOST_AUTO_TEST_SUITE(CsMaxBytes)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  cs.setByteLimit(4096);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), std::numeric_limits<size_t>::max());
+  BOOST_CHECK_EQUAL(cs.getPolicy()->isSizeAware(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 1048576
+      cs_size_aware yes
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), std::numeric_limits<size_t>::max());
+  BOOST_CHECK_EQUAL(cs.getPolicy()->isSizeAware(), false);
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 1048576);
+  BOOST_CHECK_EQUAL(cs.getPolicy()->isSizeAware(), true);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    tables
+    {
+      cs_max_bytes invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG1, false), ConfigFile::Error);
+
+  const std::string CONFIG2 = R"CONFIG(
+    tables
+    {
+      cs_size_aware maybe
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG2, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsMaxBytes
+
 BOOST_AUTO_TEST_SUITE(CsPolicy)
 
 BOOST_AUTO_TEST_CASE(Default)
@@ -203,6 +266,344 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsPolicy
 
+BOOST_AUTO_TEST_SUITE(CsDisk)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  auto dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "tables-cs-disk";
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk_path )CONFIG" + dir.string() + R"CONFIG(
+      cs_disk_max_bytes 134217728
+    }
+  )CONFIG";
+
+  boost::filesystem::remove_all(dir);
+  runConfig(CONFIG, true);
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+  BOOST_CHECK(boost::filesystem::is_directory(dir));
+
+  runConfig(CONFIG, false);
+  cs::DiskStore* diskStore = cs.getDiskStore();
+  BOOST_REQUIRE(diskStore != nullptr);
+  BOOST_CHECK_EQUAL(diskStore->getCapacity(), 134217728);
+
+  // unchanged options keep the disk tier and its content
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.getDiskStore(), diskStore);
+
+  const std::string CONFIG_NO_DISK = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+  runConfig(CONFIG_NO_DISK, false);
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(UnusablePath)
+{
+  auto dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "tables-cs-disk";
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  boost::filesystem::ofstream(dir / "file") << "not a directory";
+
+  const std::string CONFIG_VALID = R"CONFIG(
+    tables
+    {
+      cs_max_packets 100
+      cs_disk_path )CONFIG" + (dir / "store").string() + R"CONFIG(
+      cs_disk_max_bytes 134217728
+    }
+  )CONFIG";
+  const std::string CONFIG_UNUSABLE = R"CONFIG(
+    tables
+    {
+      cs_max_packets 200
+      cs_disk_path )CONFIG" + (dir / "file" / "store").string() + R"CONFIG(
+      cs_disk_max_bytes 134217728
+    }
+  )CONFIG";
+
+  // the dry run checks the path
+  BOOST_CHECK_THROW(runConfig(CONFIG_UNUSABLE, true), ConfigFile::Error);
+
+  runConfig(CONFIG_VALID, false);
+  cs::DiskStore* diskStore = cs.getDiskStore();
+  BOOST_REQUIRE(diskStore != nullptr);
+
+  // a failed reload keeps the previous configuration, including the disk tier
+  BOOST_CHECK_THROW(runConfig(CONFIG_UNUSABLE, false), ConfigFile::Error);
+  BOOST_CHECK_EQUAL(cs.getDiskStore(), diskStore);
+  BOOST_CHECK_EQUAL(cs.getLimit(), 100);
+
+  cs.setDiskStore(nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk_path /tmp
+      cs_disk_max_bytes invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsDisk
+
+BOOST_AUTO_TEST_SUITE(NameTreeHashtable)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  forwarder.getNameTree().setHashtableType(name_tree::HashtableType::OPEN_ADDRESSING);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(forwarder.getNameTree().getHashtableType(), name_tree::HashtableType::CHAINED);
+}
+
+BOOST_AUTO_TEST_CASE(Known)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      name_tree_hashtable open-addressing
+    }
+  )CONFIG";
+
+  NameTree& nameTree = forwarder.getNameTree();
+  size_t nEntries = nameTree.size();
+  BOOST_REQUIRE_GT(nEntries, 0);
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(nameTree.getHashtableType(), name_tree::HashtableType::CHAINED);
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(nameTree.getHashtableType(), name_tree::HashtableType::OPEN_ADDRESSING);
+  BOOST_CHECK_EQUAL(nameTree.size(), nEntries);
+  BOOST_CHECK(nameTree.findExactMatch("/") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Unknown)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      name_tree_hashtable unknown
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // NameTreeHashtable
+
+BOOST_AUTO_TEST_SUITE(DeadNonceListConfig)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  forwarder.getDeadNonceList().setType(DeadNonceListType::FILTER);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(forwarder.getDeadNonceList().getType(), DeadNonceListType::EXACT);
+}
+
+BOOST_AUTO_TEST_CASE(Filter)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      dead_nonce_list filter
+      dead_nonce_list_capacity 50000
+      dead_nonce_list_fp_rate 0.001
+    }
+  )CONFIG";
+
+  auto& dnl = forwarder.getDeadNonceList();
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::EXACT);
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::FILTER);
+  BOOST_REQUIRE(dnl.getFilterOptions() != nullptr);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->capacity, 50000);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->fpRate, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(FilterDefaults)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      dead_nonce_list filter
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, false);
+  auto& dnl = forwarder.getDeadNonceList();
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::FILTER);
+  BOOST_REQUIRE(dnl.getFilterOptions() != nullptr);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->capacity, DeadNonceFilter::Options().capacity);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->fpRate, DeadNonceFilter::Options().fpRate);
+}
+
+BOOST_AUTO_TEST_CASE(Unknown)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      dead_nonce_list unknown
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadCapacity)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      dead_nonce_list filter
+      dead_nonce_list_capacity 0
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadFpRate)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    tables
+    {
+      dead_nonce_list filter
+      dead_nonce_list_fp_rate 1.5
+    }
+  )CONFIG";
+  const std::string CONFIG2 = R"CONFIG(
+    tables
+    {
+      dead_nonce_list filter
+      dead_nonce_list_fp_rate zero
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG1, false), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG2, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // DeadNonceListConfig
+
+BOOST_AUTO_TEST_SUITE(FibLpmFilter)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  forwarder.getFib().setLpmFilterEnabled(true);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isLpmFilterEnabled(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Enable)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      fib_lpm_filter yes
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isLpmFilterEnabled(), false);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isLpmFilterEnabled(), true);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      fib_lpm_filter maybe
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FibLpmFilter
+
+BOOST_AUTO_TEST_CASE(IssuePitTokens)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    tables
+    {
+      issue_pit_tokens yes
+    }
+  )CONFIG";
+  const std::string CONFIG2 = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+  const std::string CONFIG3 = R"CONFIG(
+    tables
+    {
+      issue_pit_tokens sometimes
+    }
+  )CONFIG";
+
+  runConfig(CONFIG1, true);
+  BOOST_CHECK_EQUAL(forwarder.isPitTokenIssuingEnabled(), false);
+  runConfig(CONFIG1, false);
+  BOOST_CHECK_EQUAL(forwarder.isPitTokenIssuingEnabled(), true);
+  runConfig(CONFIG2, false);
+  BOOST_CHECK_EQUAL(forwarder.isPitTokenIssuingEnabled(), false);
+  BOOST_CHECK_THROW(runConfig(CONFIG3, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG3, false), ConfigFile::Error);
+}
+
 class CsUnsolicitedPolicyFixture : public TablesConfigSectionFixture
 {
 protected:
@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-disk-store.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+class DiskStoreFixture : public GlobalIoTimeFixture
+{
+protected:
+  DiskStoreFixture()
+    : dir(boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-disk-store")
+  {
+    boost::filesystem::remove_all(dir);
+  }
+
+  ~DiskStoreFixture() override
+  {
+    boost::filesystem::remove_all(dir);
+  }
+
+  shared_ptr<Data>
+  makeSizedData(const Name& name, size_t contentSize = 100)
+  {
+    auto data = makeData(name);
+    std::vector<uint8_t> content(contentSize, 0xBB);
+    data->setContent(content.data(), content.size());
+    data->wireEncode();
+    return data;
+  }
+
+  /** \return number of files in dir whose names start with \p prefix
+   */
+  size_t
+  countFiles(const std::string& prefix = "segment-") const
+  {
+    size_t n = 0;
+    for (boost::filesystem::directory_iterator it(dir), end; it != end; ++it) {
+      n += it->path().filename().string().compare(0, prefix.size(), prefix) == 0;
+    }
+    return n;
+  }
+
+protected:
+  boost::filesystem::path dir;
+};
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsDiskStore, DiskStoreFixture)
+
+BOOST_AUTO_TEST_CASE(InsertExtract)
+{
+  DiskStore store(dir, 8192, 4096);
+  BOOST_CHECK_EQUAL(store.getCapacity(), 8192);
+  BOOST_CHECK_EQUAL(countFiles(), 2);
+
+  auto dataA = makeSizedData("/A/1");
+  auto dataB = makeSizedData("/B/1");
+  BOOST_CHECK(store.insert(*dataA, time::steady_clock::now() + 1_s));
+  BOOST_CHECK(store.insert(*dataB, time::steady_clock::now() + 1_s));
+  BOOST_CHECK_EQUAL(store.size(), 2);
+  BOOST_CHECK_EQUAL(store.getNBytes(), dataA->wireEncode().size() + dataB->wireEncode().size());
+
+  // without CanBePrefix, a prefix of the Data name does not match
+  BOOST_CHECK(store.extract(*makeInterest("/A")).data == nullptr);
+
+  auto extracted = store.extract(*makeInterest("/A/1"));
+  BOOST_REQUIRE(extracted.data != nullptr);
+  BOOST_CHECK_EQUAL(extracted.data->wireEncode(), dataA->wireEncode());
+  BOOST_CHECK_EQUAL(store.size(), 1);
+
+  // an extracted Data is no longer in the store
+  BOOST_CHECK(store.extract(*makeInterest("/A/1")).data == nullptr);
+
+  extracted = store.extract(*makeInterest("/B", true));
+  BOOST_REQUIRE(extracted.data != nullptr);
+  BOOST_CHECK_EQUAL(extracted.data->getFullName(), dataB->getFullName());
+  BOOST_CHECK_EQUAL(store.size(), 0);
+  BOOST_CHECK_EQUAL(store.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FullName)
+{
+  DiskStore store(dir, 4096, 4096);
+  auto data1 = makeSizedData("/A", 100);
+  auto data2 = makeSizedData("/A", 200);
+  store.insert(*data1, time::steady_clock::now());
+  store.insert(*data2, time::steady_clock::now());
+
+  auto extracted = store.extract(*makeInterest(data2->getFullName()));
+  BOOST_REQUIRE(extracted.data != nullptr);
+  BOOST_CHECK_EQUAL(extracted.data->getFullName(), data2->getFullName());
+  BOOST_CHECK_EQUAL(store.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh)
+{
+  DiskStore store(dir, 4096, 4096);
+  store.insert(*makeSizedData("/A/1"), time::steady_clock::now() + 1_s);
+
+  advanceClocks(2_s);
+  auto interest = makeInterest("/A/1");
+  interest->setMustBeFresh(true);
+  BOOST_CHECK(store.extract(*interest).data == nullptr);
+
+  interest->setMustBeFresh(false);
+  BOOST_CHECK(store.extract(*interest).data != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Recycle)
+{
+  DiskStore store(dir, 2048, 1024);
+  auto now = time::steady_clock::now();
+
+  // each Data is about 400 octets, so that two of them fit in a segment
+  std::vector<shared_ptr<Data>> data;
+  for (int i = 0; i < 5; ++i) {
+    data.push_back(makeSizedData(Name("/A").appendNumber(i), 400));
+    BOOST_CHECK(store.insert(*data.back(), now));
+  }
+
+  // the fifth Data caused the first segment to be recycled, dropping the first two Data
+  BOOST_CHECK_EQUAL(store.size(), 3);
+  BOOST_CHECK(store.extract(*makeInterest(data[0]->getName())).data == nullptr);
+  BOOST_CHECK(store.extract(*makeInterest(data[1]->getName())).data == nullptr);
+  for (int i = 2; i < 5; ++i) {
+    auto extracted = store.extract(*makeInterest(data[i]->getName()));
+    BOOST_REQUIRE(extracted.data != nullptr);
+    BOOST_CHECK_EQUAL(extracted.data->wireEncode(), data[i]->wireEncode());
+  }
+
+  // a Data larger than a segment is not stored
+  BOOST_CHECK(!store.insert(*makeSizedData("/B", 2000), now));
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  DiskStore store(dir, 4096, 4096);
+  auto now = time::steady_clock::now();
+  store.insert(*makeSizedData("/A/1"), now);
+  store.insert(*makeSizedData("/A/2"), now);
+  store.insert(*makeSizedData("/A/3"), now);
+  store.insert(*makeSizedData("/B/1"), now);
+
+  BOOST_CHECK_EQUAL(store.erase("/A", 2), 2);
+  BOOST_CHECK_EQUAL(store.size(), 2);
+  BOOST_CHECK_EQUAL(store.erase("/A", 2), 1);
+  BOOST_CHECK_EQUAL(store.erase("/", 5), 1);
+  BOOST_CHECK_EQUAL(store.size(), 0);
+  BOOST_CHECK_EQUAL(store.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveFiles)
+{
+  {
+    DiskStore store(dir, 4096, 4096);
+    BOOST_CHECK_EQUAL(countFiles(), 1);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(*boost::filesystem::directory_iterator(dir)), 4096);
+  }
+  BOOST_CHECK_EQUAL(countFiles(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveStaleFiles)
+{
+  // a segment file left behind by another process
+  boost::filesystem::create_directories(dir);
+  boost::filesystem::ofstream(dir / "segment-0-0-0") << "stale";
+  boost::filesystem::ofstream(dir / "unrelated") << "kept";
+
+  DiskStore store(dir, 4096, 4096);
+  BOOST_CHECK(!boost::filesystem::exists(dir / "segment-0-0-0"));
+  BOOST_CHECK(boost::filesystem::exists(dir / "unrelated"));
+  BOOST_CHECK_EQUAL(countFiles(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceInSameDirectory)
+{
+  auto oldStore = make_unique<DiskStore>(dir, 8192, 4096);
+  auto data = makeSizedData("/A/1");
+  BOOST_CHECK(oldStore->insert(*data, time::steady_clock::now() + 1_s));
+
+  // the new store does not touch the files of the old one
+  auto newStore = make_unique<DiskStore>(dir, 4096, 4096);
+  BOOST_CHECK_EQUAL(countFiles(), 3);
+  auto extracted = oldStore->extract(*makeInterest("/A/1"));
+  BOOST_REQUIRE(extracted.data != nullptr);
+  BOOST_CHECK(extracted.data->wireEncode() == data->wireEncode());
+
+  oldStore.reset();
+  BOOST_CHECK_EQUAL(countFiles(), 1);
+  newStore.reset();
+  BOOST_CHECK_EQUAL(countFiles(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckDirectory)
+{
+  BOOST_CHECK_NO_THROW(DiskStore::checkDirectory(dir / "sub"));
+  BOOST_CHECK(boost::filesystem::is_directory(dir / "sub"));
+  BOOST_CHECK(boost::filesystem::is_empty(dir / "sub"));
+
+  boost::filesystem::ofstream(dir / "file") << "not a directory";
+  BOOST_CHECK_THROW(DiskStore::checkDirectory(dir / "file"), DiskStore::Error);
+  BOOST_CHECK_THROW(DiskStore(dir / "file" / "sub", 4096, 4096), DiskStore::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsDiskStore
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
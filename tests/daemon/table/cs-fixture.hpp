@@ -61,6 +61,18 @@ protected:
     return data->getFullName();
   }
 
+  /** \brief returns a modifyData function that pads the Content of a Data to \p size octets
+   */
+  static std::function<void(Data&)>
+  padContent(size_t size)
+  {
+    return [size] (Data& data) {
+      std::vector<uint8_t> content(data.getContent().value_begin(), data.getContent().value_end());
+      content.resize(size);
+      data.setContent(content.data(), content.size());
+    };
+  }
+
   Interest&
   startInterest(const Name& name)
   {
@@ -81,6 +81,70 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByBytes, CsFixture)
+{
+  cs.setPolicy(make_unique<LruPolicy>());
+  cs.setLimit(100);
+
+  insert(1, "/A", padContent(1000));
+  insert(2, "/B", padContent(1000));
+  insert(3, "/C", padContent(1000));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  size_t entrySize = cs.getNBytes() / 3;
+  BOOST_CHECK_GT(entrySize, 1000);
+
+  // evict A
+  cs.setByteLimit(entrySize * 3 - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), entrySize * 2);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+
+  // use B, then evict C
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  insert(4, "/D", padContent(1000));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+
+  // a Data larger than the byte limit is not admitted
+  insert(5, "/E", padContent(entrySize * 3));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/E");
+  CHECK_CS_FIND(0);
+
+  BOOST_CHECK_EQUAL(erase("/", 10), 2);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(SizeAware, CsFixture)
+{
+  cs.setPolicy(make_unique<LruPolicy>());
+  cs.setLimit(100);
+  cs.getPolicy()->setSizeAware(true);
+
+  insert(1, "/A", padContent(10));
+  insert(2, "/B", padContent(1000));
+  insert(3, "/C", padContent(10));
+
+  // B is the largest among the least recently used entries
+  cs.setByteLimit(cs.getNBytes() - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+
+  // the size-aware flag and the limits are kept when the policy is changed
+  cs.erase("/", 10, [] (size_t) {});
+  cs.setPolicy(make_unique<LruPolicy>());
+  BOOST_CHECK(cs.getPolicy()->isSizeAware());
+  BOOST_CHECK_EQUAL(cs.getLimit(), 100);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -96,6 +96,37 @@ BOOST_FIXTURE_TEST_CASE(Refresh, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(SizeAware, CsFixture)
+{
+  cs.setPolicy(make_unique<PriorityFifoPolicy>());
+  cs.setLimit(100);
+  cs.getPolicy()->setSizeAware(true);
+
+  auto fresh = [] (size_t size) {
+    return [size] (Data& data) {
+      padContent(size)(data);
+      data.setFreshnessPeriod(99999_ms);
+    };
+  };
+  insert(1, "/A", fresh(10));
+  insert(2, "/B", fresh(1000));
+  insert(3, "/C", fresh(10));
+  insert(4, "/D", fresh(500), true);
+
+  // evict /D (unsolicited) first
+  size_t nBytes = cs.getNBytes();
+  cs.setByteLimit(nBytes - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  // then /B, the largest in the FIFO queue
+  cs.setByteLimit(cs.getNBytes() - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsPriorityFifo
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -29,6 +29,8 @@
 
 #include <ndn-cxx/lp/tags.hpp>
 
+#include <boost/filesystem.hpp>
+
 namespace nfd {
 namespace cs {
 namespace tests {
@@ -87,6 +89,51 @@ BOOST_AUTO_TEST_CASE(FullName_EmptyDataName)
   CHECK_CS_FIND(2);
 }
 
+BOOST_AUTO_TEST_CASE(SameDataName)
+{
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  insert(3, "/A/B");
+  uint32_t first = n1[-1] < n2[-1] ? 1 : 2;
+  uint32_t second = 3 - first;
+  Name secondName = first == 1 ? n2 : n1;
+
+  startInterest("/A");
+  CHECK_CS_FIND(first);
+
+  // erase the first entry with name /A, which is referenced by the name index
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A");
+  CHECK_CS_FIND(second);
+  startInterest(secondName);
+  CHECK_CS_FIND(second);
+
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/A/B");
+  CHECK_CS_FIND(3);
+}
+
+BOOST_AUTO_TEST_CASE(SameDataNameEvicted)
+{
+  cs.setLimit(2);
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  Name n3 = insert(3, "/A");
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  startInterest(n1);
+  CHECK_CS_FIND(0);
+  startInterest(n2);
+  CHECK_CS_FIND(2);
+  startInterest(n3);
+  CHECK_CS_FIND(3);
+
+  startInterest("/A");
+  CHECK_CS_FIND(n2[-1] < n3[-1] ? 2 : 3);
+}
+
 BOOST_AUTO_TEST_CASE(PrefixName)
 {
   insert(1, "/A");
@@ -177,6 +224,40 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK_EQUAL(cs.size(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(DiskTier)
+{
+  auto dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-disk-tier";
+  cs.setLimit(1);
+  cs.setDiskStore(make_unique<DiskStore>(dir, 4096, 4096));
+
+  insert(1, "/A");
+  insert(2, "/B");
+  insert(3, "/C", nullptr, true);
+  // /A is demoted when /B is inserted; unsolicited /C evicts /B but /C is not demoted later
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getDiskStore()->size(), 2);
+
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  // /A is promoted, and unsolicited /C is discarded
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.begin()->getName(), "/A");
+  BOOST_CHECK_EQUAL(cs.getDiskStore()->size(), 1);
+
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+
+  // erasure covers both tiers
+  BOOST_CHECK_EQUAL(erase("/", 10), 2);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(cs.getDiskStore()->size(), 0);
+
+  cs.setDiskStore(nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
 // When the capacity limit is set to zero, Data cannot be inserted;
 // this test case covers this situation.
 // The behavior of non-zero capacity limit depends on the eviction policy,
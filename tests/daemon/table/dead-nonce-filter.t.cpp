@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/dead-nonce-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <random>
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestDeadNonceFilter)
+
+BOOST_AUTO_TEST_CASE(InvalidOptions)
+{
+  DeadNonceFilter::Options options;
+  options.capacity = 0;
+  BOOST_CHECK_THROW(DeadNonceFilter{options}, std::invalid_argument);
+
+  options = {};
+  options.fpRate = 0.0;
+  BOOST_CHECK_THROW(DeadNonceFilter{options}, std::invalid_argument);
+  options.fpRate = 1.0;
+  BOOST_CHECK_THROW(DeadNonceFilter{options}, std::invalid_argument);
+
+  options = {};
+  options.nSlices = 1;
+  BOOST_CHECK_THROW(DeadNonceFilter{options}, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Size)
+{
+  DeadNonceFilter::Options options;
+  options.capacity = 300000;
+  options.fpRate = 0.0001;
+  options.nSlices = 4;
+  DeadNonceFilter filter(options);
+
+  // 100000 hashes per slice at 0.0025% each need about 22 bits per hash
+  BOOST_CHECK_GE(filter.getNBytes(), 4 * 100000 * 21 / 8);
+  BOOST_CHECK_LE(filter.getNBytes(), 4 * 100000 * 23 / 8);
+  BOOST_CHECK_GE(filter.getNHashes(), 14);
+  BOOST_CHECK_LE(filter.getNHashes(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(Rotate)
+{
+  DeadNonceFilter::Options options;
+  options.capacity = 300;
+  options.nSlices = 4;
+  DeadNonceFilter filter(options);
+  size_t nBytes = filter.getNBytes();
+
+  filter.add(1);
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK(filter.has(1));
+  BOOST_CHECK(!filter.has(2));
+
+  for (int i = 0; i < 3; ++i) {
+    filter.rotate();
+    filter.add(100 + i);
+    BOOST_CHECK(filter.has(1));
+  }
+  BOOST_CHECK_EQUAL(filter.size(), 4);
+
+  // the slice containing 1 is reused
+  filter.rotate();
+  BOOST_CHECK(!filter.has(1));
+  BOOST_CHECK(filter.has(100));
+  BOOST_CHECK(filter.has(102));
+  BOOST_CHECK_EQUAL(filter.size(), 3);
+  BOOST_CHECK_EQUAL(filter.getNBytes(), nBytes);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  DeadNonceFilter::Options options;
+  options.capacity = 30000;
+  options.fpRate = 0.01;
+  options.nSlices = 4;
+  DeadNonceFilter filter(options);
+
+  std::mt19937_64 gen(1);
+  std::vector<uint64_t> added;
+  for (int slice = 0; slice < 3; ++slice) {
+    if (slice > 0) {
+      filter.rotate();
+    }
+    for (size_t i = 0; i < options.capacity / 3; ++i) {
+      added.push_back(gen());
+      filter.add(added.back());
+    }
+  }
+
+  for (uint64_t hash : added) {
+    BOOST_CHECK(filter.has(hash));
+  }
+
+  const size_t nLookups = 100000;
+  size_t nFalsePositives = 0;
+  for (size_t i = 0; i < nLookups; ++i) {
+    nFalsePositives += filter.has(gen());
+  }
+  BOOST_CHECK_LT(nFalsePositives, nLookups * options.fpRate * 1.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDeadNonceFilter
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace nfd
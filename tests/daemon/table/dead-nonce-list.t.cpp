@@ -53,6 +53,72 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
 }
 
+BOOST_AUTO_TEST_CASE(BasicFilter)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const Interest::Nonce nonce1(0x53b4eaa8);
+  const Interest::Nonce nonce2(0x1f46372b);
+
+  DeadNonceList dnl;
+  dnl.setType(DeadNonceListType::FILTER);
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::FILTER);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
+}
+
+BOOST_AUTO_TEST_CASE(SetType)
+{
+  Name nameA("ndn:/A");
+  const Interest::Nonce nonce1(0x53b4eaa8);
+
+  DeadNonceList dnl;
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::EXACT);
+  BOOST_CHECK(dnl.getFilterOptions() == nullptr);
+  size_t exactBytes = dnl.getNBytes();
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_GT(dnl.getNBytes(), exactBytes);
+
+  // existing entries are carried over to the filter
+  DeadNonceFilter::Options options;
+  options.capacity = 1000;
+  dnl.setType(DeadNonceListType::FILTER, options);
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::FILTER);
+  BOOST_REQUIRE(dnl.getFilterOptions() != nullptr);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->capacity, 1000);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+
+  // same options, entries are kept
+  dnl.setType(DeadNonceListType::FILTER, options);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+
+  // different options, entries are forgotten
+  options.fpRate = 0.001;
+  dnl.setType(DeadNonceListType::FILTER, options);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->fpRate, 0.001);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  options.fpRate = 1.0;
+  BOOST_CHECK_THROW(dnl.setType(DeadNonceListType::FILTER, options), std::invalid_argument);
+  BOOST_CHECK_EQUAL(dnl.getFilterOptions()->fpRate, 0.001);
+
+  dnl.add(nameA, nonce1);
+  dnl.setType(DeadNonceListType::EXACT);
+  BOOST_CHECK_EQUAL(dnl.getType(), DeadNonceListType::EXACT);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+}
+
 BOOST_AUTO_TEST_CASE(MinLifetime)
 {
   BOOST_CHECK_THROW(DeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
@@ -128,6 +194,31 @@ BOOST_FIXTURE_TEST_CASE(Lifetime, PeriodicalInsertionFixture)
   BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
 }
 
+BOOST_FIXTURE_TEST_CASE(LifetimeFilter, PeriodicalInsertionFixture)
+{
+  DeadNonceFilter::Options options;
+  options.capacity = DeadNonceList::INITIAL_CAPACITY;
+  dnl.setType(DeadNonceListType::FILTER, options);
+
+  const int RATE = DeadNonceList::INITIAL_CAPACITY / 2;
+  this->setRate(RATE);
+  this->advanceClocksByLifetime(10.0);
+  // each slice holds the Nonces added during one third of the lifetime
+  BOOST_CHECK_LE(dnl.size(), RATE * 4 / 3 + addNonceBatch);
+
+  Name nameC("ndn:/C");
+  const Interest::Nonce nonceC(0x25390656);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(0.5); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(1.0); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+}
+
 BOOST_FIXTURE_TEST_CASE(CapacityDown, PeriodicalInsertionFixture)
 {
   ssize_t cap0 = dnl.m_capacity;
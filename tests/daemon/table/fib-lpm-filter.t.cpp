@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/fib-lpm-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fib {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestFibLpmFilter)
+
+BOOST_AUTO_TEST_CASE(AddRemove)
+{
+  LpmFilter filter(16);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_GE(filter.getCapacity(), 16);
+  BOOST_CHECK_EQUAL(filter.getMaxLength(), 0);
+
+  Name a("/A");
+  Name abc("/A/B/C");
+  name_tree::HashValue hA = name_tree::computeHash(a);
+  name_tree::HashValue hAbc = name_tree::computeHash(abc);
+  BOOST_CHECK_EQUAL(filter.mayContain(hA, 1), false);
+
+  filter.add(hA, 1);
+  filter.add(hAbc, 3);
+  BOOST_CHECK_EQUAL(filter.size(), 2);
+  BOOST_CHECK_EQUAL(filter.getMaxLength(), 3);
+  BOOST_CHECK_EQUAL(filter.mayContain(hA, 1), true);
+  BOOST_CHECK_EQUAL(filter.mayContain(hAbc, 3), true);
+  // no prefix of these lengths
+  BOOST_CHECK_EQUAL(filter.mayContain(hAbc, 2), false);
+  BOOST_CHECK_EQUAL(filter.mayContain(hAbc, 4), false);
+
+  filter.remove(hAbc, 3);
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK_EQUAL(filter.getMaxLength(), 1);
+  BOOST_CHECK_EQUAL(filter.mayContain(hAbc, 3), false);
+  BOOST_CHECK_EQUAL(filter.mayContain(hA, 1), true);
+
+  filter.remove(hA, 1);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.mayContain(hA, 1), false);
+}
+
+BOOST_AUTO_TEST_CASE(RootPrefix)
+{
+  LpmFilter filter;
+  name_tree::HashValue hRoot = name_tree::computeHash(Name());
+  BOOST_CHECK_EQUAL(filter.mayContain(hRoot, 0), false);
+
+  filter.add(hRoot, 0);
+  BOOST_CHECK_EQUAL(filter.getMaxLength(), 0);
+  BOOST_CHECK_EQUAL(filter.mayContain(hRoot, 0), true);
+
+  filter.remove(hRoot, 0);
+  BOOST_CHECK_EQUAL(filter.mayContain(hRoot, 0), false);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  const size_t N = 20000;
+  LpmFilter filter(N);
+
+  for (size_t i = 0; i < N; ++i) {
+    Name name("/P");
+    name.appendNumber(i);
+    filter.add(name_tree::computeHash(name), name.size());
+  }
+
+  size_t nFalsePositives = 0;
+  for (size_t i = 0; i < N; ++i) {
+    Name name("/P");
+    name.appendNumber(i);
+    // no false negatives
+    BOOST_CHECK(filter.mayContain(name_tree::computeHash(name), name.size()));
+
+    Name other("/Q");
+    other.appendNumber(i);
+    if (filter.mayContain(name_tree::computeHash(other), other.size())) {
+      ++nFalsePositives;
+    }
+  }
+  BOOST_CHECK_LT(nFalsePositives, N / 20);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibLpmFilter
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace fib
+} // namespace nfd
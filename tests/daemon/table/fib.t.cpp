@@ -197,6 +197,49 @@ BOOST_AUTO_TEST_CASE(Insert_LongestPrefixMatch)
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E").getPrefix(), "/");
 }
 
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithLpmFilter)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  fib.insert("/A");
+  fib.insert("/A/B/C");
+  // NameTree entries without FIB entries must not be matched
+  nameTree.lookup("/A/B/C/D/E");
+
+  fib.setLpmFilterEnabled(true);
+  BOOST_CHECK_EQUAL(fib.isLpmFilterEnabled(), true);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E").getPrefix(), "/"); // the empty entry
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B").getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E/F").getPrefix(), "/A/B/C");
+
+  // the filter grows beyond its initial capacity
+  for (int i = 0; i < 1000; ++i) {
+    fib.insert(Name("/A/B/C/D").appendNumber(i));
+  }
+  fib.insert("/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E").getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E").getPrefix(), "/A/B/C");
+  for (int i = 0; i < 1000; ++i) {
+    Name prefix = Name("/A/B/C/D").appendNumber(i);
+    BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(Name(prefix).append("E")).getPrefix(), prefix);
+  }
+
+  fib.erase("/A/B/C");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E").getPrefix(), "/A");
+  for (int i = 0; i < 1000; ++i) {
+    fib.erase(Name("/A/B/C/D").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/1").getPrefix(), "/A");
+
+  // results are the same without the filter
+  fib.setLpmFilterEnabled(false);
+  BOOST_CHECK_EQUAL(fib.isLpmFilterEnabled(), false);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/1").getPrefix(), "/A");
+  fib.insert("/A/B");
+  fib.setLpmFilterEnabled(true);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/1").getPrefix(), "/A/B");
+}
+
 BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithPitEntry)
 {
   NameTree nameTree;
@@ -362,6 +405,37 @@ BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
   BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
 }
 
+BOOST_AUTO_TEST_CASE(EntriesByFace)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  Entry* entryA = fib.insert("/A").first;
+  Entry* entryB = fib.insert("/B").first;
+  fib.addOrUpdateNextHop(*entryA, *face1, 0);
+  fib.addOrUpdateNextHop(*entryA, *face1, 10); // update, not a new nexthop
+  fib.addOrUpdateNextHop(*entryA, *face2, 0);
+  fib.addOrUpdateNextHop(*entryB, *face1, 0);
+
+  auto entries1 = fib.getEntriesByFace(*face1);
+  BOOST_CHECK((std::set<Entry*>(entries1.begin(), entries1.end()) == std::set<Entry*>{entryA, entryB}));
+  BOOST_CHECK_EQUAL(entries1.size(), 2);
+  BOOST_CHECK(fib.getEntriesByFace(*face2) == std::vector<Entry*>{entryA});
+
+  fib.removeNextHop(*entryA, *face1);
+  BOOST_CHECK(fib.getEntriesByFace(*face1) == std::vector<Entry*>{entryB});
+
+  // erasing an entry removes it from the index of each of its nexthops
+  fib.erase(*entryA);
+  BOOST_CHECK(fib.getEntriesByFace(*face2).empty());
+
+  fib.removeNextHop(*entryB, *face1);
+  BOOST_CHECK(fib.getEntriesByFace(*face1).empty());
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(Iterator)
 {
   NameTree nameTree;
@@ -53,12 +53,35 @@ BOOST_AUTO_TEST_CASE(ComputeHash)
   BOOST_CHECK_EQUAL(hashes.size(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(ComputeHashesConsistency)
+{
+  // component lengths around multiples of 8 octets, and a component with a 3-octet TLV-LENGTH
+  Name name("/A/12345/123456/1234567/123456789012345/1234567890123456");
+  name.append(std::string(300, 'x'));
+  name.appendVersion(1);
+
+  HashSequence hashes = computeHashes(name);
+  BOOST_REQUIRE_EQUAL(hashes.size(), name.size() + 1);
+  std::set<HashValue> distinct;
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(hashes[i], computeHash(name, i));
+    BOOST_CHECK_EQUAL(hashes[i], computeHash(name.getPrefix(i)));
+    distinct.insert(hashes[i]);
+  }
+  BOOST_CHECK_EQUAL(distinct.size(), hashes.size());
+
+  // prefixLen beyond the name length
+  BOOST_CHECK_EQUAL(computeHash(name, name.size() + 5), hashes.back());
+  BOOST_CHECK_EQUAL(computeHashes(name, name.size() + 5).size(), name.size() + 1);
+}
+
 BOOST_AUTO_TEST_SUITE(Hashtable)
 using name_tree::Hashtable;
 
 BOOST_AUTO_TEST_CASE(Modifiers)
 {
   Hashtable ht(HashtableOptions(16));
+  BOOST_CHECK_EQUAL(ht.getType(), HashtableType::CHAINED);
 
   Name name("/A/B/C/D");
   HashSequence hashes = computeHashes(name);
@@ -185,6 +208,122 @@ BOOST_AUTO_TEST_CASE(Resize)
 
 BOOST_AUTO_TEST_SUITE_END() // Hashtable
 
+BOOST_AUTO_TEST_SUITE(TestOpenHashtable)
+
+BOOST_AUTO_TEST_CASE(Modifiers)
+{
+  OpenHashtable ht(HashtableOptions(16));
+  BOOST_CHECK_EQUAL(ht.getType(), HashtableType::OPEN_ADDRESSING);
+
+  Name name("/A/B/C/D");
+  HashSequence hashes = computeHashes(name);
+
+  BOOST_CHECK_EQUAL(ht.size(), 0);
+  BOOST_CHECK(ht.find(name, 2) == nullptr);
+  BOOST_CHECK(ht.getFirstNode() == nullptr);
+
+  const Node* node = nullptr;
+  bool isNew = false;
+  std::tie(node, isNew) = ht.insert(name, 2, hashes);
+  BOOST_CHECK_EQUAL(isNew, true);
+  BOOST_CHECK(node != nullptr);
+  BOOST_CHECK_EQUAL(ht.size(), 1);
+  BOOST_CHECK_EQUAL(ht.find(name, 2), node);
+  BOOST_CHECK_EQUAL(ht.find(name, 2, hashes), node);
+
+  BOOST_CHECK(ht.find(name, 0) == nullptr);
+  BOOST_CHECK(ht.find(name, 1) == nullptr);
+  BOOST_CHECK(ht.find(name, 3) == nullptr);
+  BOOST_CHECK(ht.find(name, 4) == nullptr);
+
+  const Node* node2 = nullptr;
+  std::tie(node2, isNew) = ht.insert(name, 2, hashes);
+  BOOST_CHECK_EQUAL(isNew, false);
+  BOOST_CHECK_EQUAL(node2, node);
+  BOOST_CHECK_EQUAL(ht.size(), 1);
+
+  std::tie(node2, isNew) = ht.insert(name, 4, hashes);
+  BOOST_CHECK_EQUAL(isNew, true);
+  BOOST_CHECK(node2 != nullptr);
+  BOOST_CHECK_NE(node2, node);
+  BOOST_CHECK_EQUAL(ht.size(), 2);
+  BOOST_CHECK_EQUAL(ht.getFirstNode(), node2);
+  BOOST_CHECK_EQUAL(ht.getNextNode(node2), node);
+  BOOST_CHECK(ht.getNextNode(node) == nullptr);
+
+  ht.erase(const_cast<Node*>(node2));
+  BOOST_CHECK_EQUAL(ht.size(), 1);
+  BOOST_CHECK(ht.find(name, 4) == nullptr);
+  BOOST_CHECK_EQUAL(ht.find(name, 2), node);
+
+  ht.erase(const_cast<Node*>(node));
+  BOOST_CHECK_EQUAL(ht.size(), 0);
+  BOOST_CHECK(ht.find(name, 2) == nullptr);
+  BOOST_CHECK(ht.find(name, 4) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalResize)
+{
+  HashtableOptions options(10);
+  OpenHashtable ht(options);
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 16);
+
+  const int nNodes = 5000;
+  auto makeName = [] (int i) {
+    Name name;
+    name.appendNumber(i);
+    return name;
+  };
+  auto checkAllFound = [&] (int min, int max) {
+    for (int i = min; i <= max; ++i) {
+      Name name = makeName(i);
+      const Node* node = ht.find(name, name.size());
+      BOOST_REQUIRE(node != nullptr);
+      BOOST_CHECK_EQUAL(node->entry.getName(), name);
+    }
+  };
+
+  bool hasMigrated = false;
+  for (int i = 1; i <= nNodes; ++i) {
+    Name name = makeName(i);
+    BOOST_CHECK_EQUAL(ht.insert(name, name.size(), computeHashes(name)).second, true);
+    if (ht.isMigrating()) {
+      hasMigrated = true;
+      // entries in both slot arrays can be found
+      checkAllFound(std::max(1, i - 20), i);
+    }
+  }
+  BOOST_CHECK(hasMigrated);
+  BOOST_CHECK_EQUAL(ht.size(), nNodes);
+  BOOST_CHECK_LE(ht.size(), ht.getNBuckets() * options.expandLoadFactor);
+  checkAllFound(1, nNodes);
+
+  size_t nEnumerated = 0;
+  for (const Node* node = ht.getFirstNode(); node != nullptr; node = ht.getNextNode(node)) {
+    ++nEnumerated;
+  }
+  BOOST_CHECK_EQUAL(nEnumerated, nNodes);
+
+  for (int i = 1; i <= nNodes - 10; ++i) {
+    Name name = makeName(i);
+    const Node* node = ht.find(name, name.size());
+    BOOST_REQUIRE(node != nullptr);
+    ht.erase(const_cast<Node*>(node));
+  }
+  BOOST_CHECK_EQUAL(ht.size(), 10);
+  checkAllFound(nNodes - 9, nNodes);
+
+  for (int i = nNodes - 9; i <= nNodes; ++i) {
+    Name name = makeName(i);
+    ht.erase(const_cast<Node*>(ht.find(name, name.size())));
+  }
+  BOOST_CHECK_EQUAL(ht.size(), 0);
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 16);
+  BOOST_CHECK(ht.getFirstNode() == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestOpenHashtable
+
 BOOST_AUTO_TEST_SUITE(TestEntry)
 
 BOOST_AUTO_TEST_CASE(TreeRelation)
@@ -526,6 +665,37 @@ BOOST_FIXTURE_TEST_CASE(IteratorFullEnumerate, EnumerationFixture)
     .end();
 }
 
+BOOST_FIXTURE_TEST_CASE(SetHashtableType, EnumerationFixture)
+{
+  insertAb1Ab2Ac1Ac2();
+  Entry* ab1 = nt.findExactMatch("/a/b/1");
+  BOOST_REQUIRE(ab1 != nullptr);
+  BOOST_CHECK_EQUAL(nt.getHashtableType(), HashtableType::CHAINED);
+
+  nt.setHashtableType(HashtableType::OPEN_ADDRESSING);
+  BOOST_CHECK_EQUAL(nt.getHashtableType(), HashtableType::OPEN_ADDRESSING);
+  BOOST_CHECK_EQUAL(nt.size(), 8);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/a/b/1"), ab1);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch("/a/b/1/x"), ab1);
+
+  nt.lookup("/d");
+  nt.eraseIfEmpty(nt.findExactMatch("/a/c/2"));
+  EnumerationVerifier(nt.fullEnumerate())
+    .expect("/")
+    .expect("/a")
+    .expect("/a/b")
+    .expect("/a/b/1")
+    .expect("/a/b/2")
+    .expect("/a/c")
+    .expect("/a/c/1")
+    .expect("/d")
+    .end();
+
+  nt.setHashtableType(HashtableType::CHAINED);
+  BOOST_CHECK_EQUAL(nt.size(), 8);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/a/b/1"), ab1);
+}
+
 BOOST_FIXTURE_TEST_SUITE(IteratorPartialEnumerate, EnumerationFixture)
 
 BOOST_AUTO_TEST_CASE(Empty)
@@ -691,6 +861,38 @@ BOOST_FIXTURE_TEST_CASE(IteratorFindAllMatches, EnumerationFixture)
     .end();
 }
 
+BOOST_AUTO_TEST_CASE(PrecomputedHashes)
+{
+  for (auto type : {HashtableType::CHAINED, HashtableType::OPEN_ADDRESSING}) {
+    BOOST_TEST_CONTEXT(type) {
+      NameTree nt(16, type);
+      nt.lookup("/a/b");
+      nt.lookup("/a/c/d");
+
+      Name name("/a/b/e/f");
+      HashSequence hashes = computeHashes(name);
+      // prefetching has no effect other than on caches, including for names not in the tree
+      nt.prefetchBuckets(hashes);
+      nt.prefetchNodes(hashes);
+      BOOST_CHECK_EQUAL(nt.size(), 5);
+
+      BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(name, hashes), nt.findExactMatch("/a/b"));
+      EnumerationVerifier(nt.findAllMatches(name, hashes))
+        .expect("/")
+        .expect("/a")
+        .expect("/a/b")
+        .end();
+
+      Entry& entry = nt.lookup(name, 3, hashes);
+      BOOST_CHECK_EQUAL(entry.getName(), "/a/b/e");
+      BOOST_CHECK_EQUAL(entry.getParent(), nt.findExactMatch("/a/b"));
+      BOOST_CHECK_EQUAL(&nt.lookup(name, 3), &entry);
+      BOOST_CHECK_EQUAL(nt.size(), 6);
+      BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(name, hashes), &entry);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(HashTableResizeShrink)
 {
   size_t nBuckets = 16;
@@ -29,6 +29,8 @@
 #include "tests/daemon/global-io-fixture.hpp"
 #include "tests/daemon/face/dummy-face.hpp"
 
+#include <ndn-cxx/lp/tags.hpp>
+
 #include <boost/test/data/test_case.hpp>
 
 namespace bdata = boost::unit_test::data;
@@ -170,6 +172,107 @@ BOOST_AUTO_TEST_CASE(InOutRecords)
   BOOST_CHECK(entry.getOutRecord(*face2) == entry.out_end());
 }
 
+BOOST_AUTO_TEST_CASE(RetainInterest)
+{
+  auto face1 = make_shared<DummyFace>();
+
+  // an Interest that is not decoded from a larger buffer is retained as is
+  auto interest1 = makeInterest("/A");
+  Entry entry1(*interest1);
+  BOOST_CHECK_EQUAL(&entry1.getInterest(), interest1.get());
+
+  // an Interest decoded in place from a receive buffer is copied into its own buffer
+  Block wire = makeInterest("/B")->wireEncode();
+  auto buffer = make_shared<ndn::Buffer>(ndn::MAX_NDN_PACKET_SIZE);
+  std::copy(wire.begin(), wire.end(), buffer->begin());
+  bool isOk = false;
+  Block pooled;
+  std::tie(isOk, pooled) = Block::fromBuffer(buffer, 0);
+  BOOST_REQUIRE(isOk);
+  auto interest2 = make_shared<Interest>(pooled);
+  interest2->setTag(make_shared<lp::IncomingFaceIdTag>(face1->getId()));
+
+  Entry entry2(*interest2);
+  BOOST_CHECK_NE(&entry2.getInterest(), interest2.get());
+  BOOST_CHECK_EQUAL(entry2.getInterest().wireEncode().getBuffer()->size(), wire.size());
+  BOOST_CHECK(entry2.getInterest().getTag<lp::IncomingFaceIdTag>() != nullptr);
+
+  auto in = entry2.insertOrUpdateInRecord(*face1, *interest2);
+  BOOST_CHECK_EQUAL(in->getInterest().wireEncode().getBuffer()->size(), wire.size());
+  BOOST_CHECK(in->getInterest().getTag<lp::IncomingFaceIdTag>() != nullptr);
+
+  // neither the entry nor the in-record keeps the receive buffer alive
+  interest2.reset();
+  pooled = Block();
+  BOOST_CHECK_EQUAL(buffer.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ManyRecords)
+{
+  // more records than N_INLINE_RECORDS, inserted and deleted in various orders
+  std::vector<shared_ptr<DummyFace>> faces;
+  for (size_t i = 0; i < N_INLINE_RECORDS * 3; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  auto interest = makeInterest("/uSAQ5vNq");
+  Entry entry(*interest);
+  for (const auto& face : faces) {
+    entry.insertOrUpdateInRecord(*face, *interest);
+    entry.insertOrUpdateOutRecord(*face, *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size());
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size());
+
+  for (size_t i = 0; i < faces.size(); i += 2) {
+    entry.deleteInRecord(*faces[i]);
+    entry.deleteOutRecord(*faces[faces.size() - 1 - i]);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size() / 2);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size() / 2);
+
+  for (const auto& face : faces) {
+    auto it = entry.insertOrUpdateInRecord(*face, *interest);
+    BOOST_CHECK_EQUAL(&it->getFace(), face.get());
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size());
+  for (const auto& face : faces) {
+    BOOST_CHECK(entry.getInRecord(*face) != entry.in_end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CopyRecords)
+{
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto interest = makeInterest("/fDq5lDCV");
+
+  unique_ptr<InRecordCollection> survivor;
+  {
+    Entry entry(*interest);
+    entry.insertOrUpdateInRecord(*face1, *interest);
+    entry.insertOrUpdateOutRecord(*face1, *interest);
+
+    // copies do not take nodes from the inline storage of the entry
+    survivor = make_unique<InRecordCollection>(entry.getInRecords());
+    InRecordCollection inCopy(entry.getInRecords());
+    OutRecordCollection outCopy(entry.getOutRecords());
+    BOOST_CHECK(inCopy.get_allocator() != entry.getInRecords().get_allocator());
+    BOOST_CHECK(outCopy.get_allocator() != entry.getOutRecords().get_allocator());
+    BOOST_CHECK_EQUAL(&inCopy.front().getFace(), face1.get());
+    BOOST_CHECK_EQUAL(&outCopy.front().getFace(), face1.get());
+
+    entry.insertOrUpdateInRecord(*face2, *interest);
+    entry.deleteInRecord(*face1);
+    BOOST_CHECK_EQUAL(inCopy.size(), 1);
+    BOOST_CHECK_EQUAL(&inCopy.front().getFace(), face1.get());
+  }
+
+  // a copy can outlive the entry
+  BOOST_REQUIRE_EQUAL(survivor->size(), 1);
+  BOOST_CHECK_EQUAL(&survivor->front().getFace(), face1.get());
+}
+
 const time::milliseconds lifetimes[] = {
   -1_ms, // unset
   1_ms,
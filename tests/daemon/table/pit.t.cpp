@@ -149,6 +149,162 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK(pit.find(*interest) != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(EntryMemory)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  BOOST_CHECK_EQUAL(pit.getNReservedBytes(), 0);
+
+  auto entry1 = pit.insert(*makeInterest("/kn8bOlWP")).first;
+  BOOST_CHECK_GE(pit.getEntrySize(), sizeof(Entry));
+  size_t nReservedBytes = pit.getNReservedBytes();
+  BOOST_CHECK_GE(nReservedBytes, pit.getEntrySize());
+
+  // a freed block is reused
+  pit.erase(entry1.get());
+  entry1.reset();
+  auto entry2 = pit.insert(*makeInterest("/tgB0nUcW")).first;
+  BOOST_CHECK_EQUAL(pit.getNReservedBytes(), nReservedBytes);
+
+  // an entry that outlives the PIT remains valid, whether or not it has records
+  auto interest3 = makeInterest("/BMTs9q2e");
+  auto interest4 = makeInterest("/cVT2Pn5z");
+  auto face3 = make_shared<DummyFace>();
+  shared_ptr<Entry> entry3, entry4;
+  {
+    NameTree nameTree3;
+    Pit pit3(nameTree3);
+    entry3 = pit3.insert(*interest3).first;
+    entry4 = pit3.insert(*interest4).first;
+    entry4->insertOrUpdateInRecord(*face3, *interest4);
+  }
+  BOOST_CHECK_EQUAL(entry3->getName(), interest3->getName());
+  entry3->insertOrUpdateInRecord(*face3, *interest3);
+  entry3->insertOrUpdateOutRecord(*face3, *interest3);
+  entry3->deleteInRecord(*face3);
+  BOOST_CHECK_EQUAL(entry3->getOutRecords().size(), 1);
+  entry4->deleteInRecord(*face3);
+  BOOST_CHECK(entry4->getInRecords().empty());
+}
+
+BOOST_AUTO_TEST_CASE(EntriesByFace)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  auto interestA = makeInterest("/A");
+  auto interestB = makeInterest("/B");
+  auto entryA = pit.insert(*interestA).first;
+  auto entryB = pit.insert(*interestB).first;
+  BOOST_CHECK(pit.getEntriesByFace(*face1).empty());
+
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face2, *interestA);
+  entryB->insertOrUpdateInRecord(*face2, *interestB);
+  BOOST_CHECK(pit.getEntriesByFace(*face1) == std::vector<Entry*>{entryA.get()});
+  BOOST_CHECK_EQUAL(pit.getEntriesByFace(*face2).size(), 2);
+
+  // the out-record still refers to face1
+  entryA->deleteInRecord(*face1);
+  BOOST_CHECK(pit.getEntriesByFace(*face1) == std::vector<Entry*>{entryA.get()});
+  entryA->deleteOutRecord(*face1);
+  BOOST_CHECK(pit.getEntriesByFace(*face1).empty());
+
+  entryB->clearInRecords();
+  BOOST_CHECK(pit.getEntriesByFace(*face2) == std::vector<Entry*>{entryA.get()});
+
+  // an erased entry is no longer indexed, even if it is modified afterwards
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.getEntriesByFace(*face2).empty());
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  BOOST_CHECK(pit.getEntriesByFace(*face1).empty());
+
+  pit.deleteInOutRecords(entryB.get(), *face2);
+  entryB->insertOrUpdateOutRecord(*face1, *interestB);
+  pit.deleteInOutRecords(entryB.get(), *face1);
+  BOOST_CHECK(pit.getEntriesByFace(*face1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Tokens)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+
+  auto interestA = makeInterest("/A");
+  auto interestB = makeInterest("/B");
+  auto entryA = pit.insert(*interestA).first;
+  auto entryB = pit.insert(*interestB).first;
+
+  lp::PitToken tokenA = pit.issueToken(*entryA);
+  lp::PitToken tokenB = pit.issueToken(*entryB);
+  BOOST_CHECK(tokenA != tokenB);
+  BOOST_CHECK(pit.issueToken(*entryA) == tokenA);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenA), entryA.get());
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenB), entryB.get());
+
+  // tokens not issued by this PIT
+  std::vector<uint8_t> bytes{0xA0, 0xA1, 0xA2};
+  BOOST_CHECK(pit.findByToken(lp::PitToken(std::make_pair(bytes.cbegin(), bytes.cend()))) == nullptr);
+  bytes.assign(tokenA.begin(), tokenA.end());
+  bytes.back() ^= 0xFF;
+  BOOST_CHECK(pit.findByToken(lp::PitToken(std::make_pair(bytes.cbegin(), bytes.cend()))) == nullptr);
+
+  // an erased entry's token is no longer valid, even if its slot is reused
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.findByToken(tokenA) == nullptr);
+  auto interestC = makeInterest("/C");
+  auto entryC = pit.insert(*interestC).first;
+  lp::PitToken tokenC = pit.issueToken(*entryC);
+  BOOST_CHECK(tokenC != tokenA);
+  BOOST_CHECK(pit.findByToken(tokenA) == nullptr);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenC), entryC.get());
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenB), entryB.get());
+}
+
+BOOST_AUTO_TEST_CASE(DataMatchWithToken)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+
+  auto interestAB = makeInterest("/A/B");
+  auto interestA = makeInterest("/A", true);
+  auto interestABC = makeInterest("/A/B/C", true);
+  auto interestD = makeInterest("/D");
+  auto entryAB = pit.insert(*interestAB).first;
+  auto entryA = pit.insert(*interestA).first;
+  auto entryABC = pit.insert(*interestABC).first;
+  auto entryD = pit.insert(*interestD).first;
+  lp::PitToken tokenAB = pit.issueToken(*entryAB);
+  lp::PitToken tokenA = pit.issueToken(*entryA);
+  lp::PitToken tokenD = pit.issueToken(*entryD);
+
+  auto toSet = [] (const DataMatchResult& matches) {
+    std::set<Entry*> entries;
+    for (const auto& entry : matches) {
+      entries.insert(entry.get());
+    }
+    BOOST_CHECK_EQUAL(entries.size(), matches.size());
+    return entries;
+  };
+
+  auto data = makeData("/A/B");
+  std::set<Entry*> expected{entryAB.get(), entryA.get()};
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data)) == expected);
+  // the hinted entry is at the depth of the Data name
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, tokenAB)) == expected);
+  // the hinted entry is not at the depth of the Data name
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, tokenA)) == expected);
+  // the hinted entry does not match the Data
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, tokenD)) == expected);
+
+  pit.erase(entryAB.get());
+  expected.erase(entryAB.get());
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, tokenAB)) == expected);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   NameTree nameTree;
@@ -242,6 +242,43 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithPitEntry)
   BOOST_CHECK_EQUAL(this->findInstanceName(*pitFull), strategyNameQ);
 }
 
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCached)
+{
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<pit::Entry> pit1 = pit.insert(*makeInterest("/A/B/C/1")).first;
+  shared_ptr<pit::Entry> pit2 = pit.insert(*makeInterest("/A/B/C/2")).first;
+
+  // second lookup stops at /A/B/C, whose cache is filled by the first lookup
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit1), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit2), strategyNameP);
+  BOOST_CHECK_EQUAL(&sc.findEffectiveStrategy(*pit2), &sc.findEffectiveStrategy("/A"));
+
+  BOOST_CHECK(sc.insert("/A/B", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit1), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit2), strategyNameQ);
+
+  sc.erase("/A/B");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit1), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit2), strategyNameP);
+
+  // replacing the strategy of an existing entry destroys the old instance
+  BOOST_CHECK(sc.insert("/A", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit1), strategyNameQ);
+  BOOST_CHECK_EQUAL(&sc.findEffectiveStrategy(*pit2), &sc.findEffectiveStrategy("/A"));
+
+  sc.erase("/A");
+  BOOST_CHECK_EQUAL(&sc.findEffectiveStrategy(*pit1), &sc.findEffectiveStrategy("/"));
+
+  Measurements& measurements = forwarder.getMeasurements();
+  measurements::Entry& mABCD = measurements.get("/A/B/C/D");
+  BOOST_CHECK_EQUAL(&sc.findEffectiveStrategy(mABCD), &sc.findEffectiveStrategy("/"));
+  BOOST_CHECK(sc.insert("/A/B/C", strategyNameP));
+  BOOST_CHECK_EQUAL(this->findInstanceName(mABCD), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pit1), strategyNameP);
+}
+
 BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
 {
   BOOST_CHECK(sc.insert("/A", strategyNameP));
@@ -28,7 +28,11 @@
 
 #include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
 
+#include <boost/filesystem.hpp>
+
+#include <cmath>
 #include <iostream>
+#include <random>
 
 #ifdef HAVE_VALGRIND
 #include <valgrind/callgrind.h>
@@ -215,5 +219,99 @@ BOOST_FIXTURE_TEST_CASE(FindCanBePrefixHit, CsBenchmarkFixture)
   std::cout << "find(CanBePrefix-hit) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// insert, find(exact) hit, and find(exact) miss with a large capacity
+BOOST_FIXTURE_TEST_CASE(LargeCapacity, CsBenchmarkFixture)
+{
+  // workloads are generated in chunks, so that only the CS itself needs to fit in memory
+  constexpr size_t CHUNK_SIZE = 100000;
+
+  for (size_t capacity : {1000000, 10000000}) {
+    Cs largeCs(capacity);
+    time::microseconds dInsert(0);
+    time::microseconds dFindHit(0);
+    time::microseconds dFindMiss(0);
+
+    for (size_t offset = 0; offset < capacity; offset += CHUNK_SIZE) {
+      auto genName = [offset] (size_t i) { return SimpleNameGenerator()(offset + i); };
+      auto dataWorkload = makeDataWorkload(CHUNK_SIZE, genName);
+      dInsert += timedRun([&] {
+        for (const auto& data : dataWorkload) {
+          largeCs.insert(*data, false);
+        }
+      });
+    }
+    BOOST_REQUIRE_EQUAL(largeCs.size(), capacity);
+
+    for (size_t offset = 0; offset < capacity; offset += CHUNK_SIZE) {
+      auto genHit = [offset] (size_t i) { return SimpleNameGenerator()(offset + i); };
+      auto hitWorkload = makeInterestWorkload(CHUNK_SIZE, genHit);
+      dFindHit += timedRun([&] {
+        for (const auto& interest : hitWorkload) {
+          largeCs.find(*interest, bind([]{}), bind([]{}));
+        }
+      });
+
+      auto genMiss = [offset] (size_t i) { return SimpleNameGenerator("/cs/miss")(offset + i); };
+      auto missWorkload = makeInterestWorkload(CHUNK_SIZE, genMiss);
+      dFindMiss += timedRun([&] {
+        for (const auto& interest : missWorkload) {
+          largeCs.find(*interest, bind([]{}), bind([]{}));
+        }
+      });
+    }
+
+    std::cout << "capacity " << capacity << " insert: " << dInsert
+              << ", find(hit): " << dFindHit
+              << ", find(miss): " << dFindMiss << std::endl;
+  }
+}
+
+// find, then insert on miss, with a skewed popularity; with and without the disk tier
+BOOST_FIXTURE_TEST_CASE(DiskTier, CsBenchmarkFixture)
+{
+  constexpr size_t N_NAMES = CS_CAPACITY * 10;
+  constexpr size_t N_REQUESTS = N_NAMES * 4;
+  const auto dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-benchmark-disk";
+
+  auto interestWorkload = makeInterestWorkload(N_NAMES);
+  auto dataWorkload = makeDataWorkload(N_NAMES);
+
+  // popularity decreases with the index: P(index < x * N_NAMES) = x^(1/3)
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> dist;
+  std::vector<size_t> requests(N_REQUESTS);
+  for (size_t& i : requests) {
+    i = std::min(N_NAMES - 1, static_cast<size_t>(N_NAMES * std::pow(dist(gen), 3.0)));
+  }
+
+  for (bool useDisk : {false, true}) {
+    Cs tieredCs(CS_CAPACITY);
+    if (useDisk) {
+      tieredCs.setDiskStore(make_unique<cs::DiskStore>(dir, 1024 * 1024 * 1024));
+    }
+
+    size_t nHits = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t i : requests) {
+        bool isHit = false;
+        tieredCs.find(*interestWorkload[i], [&] (const Interest&, const Data&) { isHit = true; },
+                      bind([]{}));
+        if (isHit) {
+          ++nHits;
+        }
+        else {
+          tieredCs.insert(*dataWorkload[i], false);
+        }
+      }
+    });
+
+    std::cout << (useDisk ? "with" : "without") << " disk tier: find-insert " << N_REQUESTS
+              << ": " << d << ", hit ratio " << static_cast<double>(nHits) / N_REQUESTS
+              << std::endl;
+  }
+
+  boost::filesystem::remove_all(dir);
+}
+
 } // namespace tests
 } // namespace nfd
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "common/global.hpp"
+#include "table/dead-nonce-list.hpp"
+
+#include <ndn-cxx/util/time-unit-test-clock.hpp>
+
+#include <chrono>
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+class DeadNonceListBenchmarkFixture
+{
+protected:
+  DeadNonceListBenchmarkFixture()
+    : m_steadyClock(make_shared<time::UnitTestSteadyClock>())
+    , m_systemClock(make_shared<time::UnitTestSystemClock>())
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+    // the Dead Nonce List adapts its capacity over several lifetimes, which are simulated
+    time::setCustomClocks(m_steadyClock, m_systemClock);
+  }
+
+  ~DeadNonceListBenchmarkFixture()
+  {
+    time::setCustomClocks(nullptr, nullptr);
+  }
+
+  /** \brief add \p rate Nonces per lifetime for \p nLifetimes lifetimes
+   */
+  void
+  addNonces(DeadNonceList& dnl, size_t rate, size_t nLifetimes)
+  {
+    const size_t nStepsPerLifetime = 50;
+    for (size_t i = 0; i < nLifetimes * nStepsPerLifetime; ++i) {
+      for (size_t j = 0; j < rate / nStepsPerLifetime; ++j) {
+        dnl.add(m_name, Interest::Nonce(++m_lastNonce));
+      }
+      m_steadyClock->advance(dnl.getLifetime() / nStepsPerLifetime);
+      m_systemClock->advance(dnl.getLifetime() / nStepsPerLifetime);
+      getGlobalIoService().poll();
+    }
+  }
+
+protected:
+  Name m_name = "/benchmark/dead-nonce-list/segment=0";
+  uint32_t m_lastNonce = 0;
+
+private:
+  shared_ptr<time::UnitTestSteadyClock> m_steadyClock;
+  shared_ptr<time::UnitTestSystemClock> m_systemClock;
+};
+
+// This test case compares the Dead Nonce List implementations with large numbers of Nonces.
+// For each rate and implementation, Nonces are added at a steady rate until the exact
+// implementation has adapted its capacity, or until all slices of the filter are in use. Then it reports the memory used per stored Nonce,
+// and the average latency of has() for stored Nonces and for Nonces that were never added.
+// The memory usage of the exact implementation is an estimate that excludes allocator overhead.
+BOOST_FIXTURE_TEST_CASE(Comparison, DeadNonceListBenchmarkFixture)
+{
+  // number of Nonces added per lifetime
+  const size_t rates[] = {100000, 1000000};
+  const DeadNonceListType types[] = {DeadNonceListType::EXACT, DeadNonceListType::FILTER};
+  // number of lifetimes for the exact implementation to adapt its capacity
+  const size_t nWarmupLifetimes = 60;
+  // number of has() invocations per measurement
+  const size_t nLookups = 1000000;
+
+  for (size_t rate : rates) {
+    for (auto type : types) {
+      DeadNonceList dnl;
+      DeadNonceFilter::Options options;
+      options.capacity = rate;
+      dnl.setType(type, options);
+
+      // the filter has a fixed size, and only needs to fill all its slices
+      addNonces(dnl, rate, type == DeadNonceListType::EXACT ? nWarmupLifetimes : 2);
+      uint32_t lastNonce = m_lastNonce;
+
+#ifdef HAVE_VALGRIND
+      CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+      // recently added Nonces, which are stored in either implementation
+      size_t nHits = 0;
+      auto t1 = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nLookups; ++i) {
+        nHits += dnl.has(m_name, Interest::Nonce(lastNonce - i % (rate / 2)));
+      }
+      auto t2 = std::chrono::steady_clock::now();
+
+      // Nonces that were never added
+      size_t nFalsePositives = 0;
+      for (size_t i = 0; i < nLookups; ++i) {
+        nFalsePositives += dnl.has(m_name, Interest::Nonce(lastNonce + 1 + i));
+      }
+      auto t3 = std::chrono::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+      CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+      using std::chrono::nanoseconds;
+      std::cout << type << " rate=" << rate
+                << " size=" << dnl.size()
+                << " bytes=" << dnl.getNBytes()
+                << " bytes-per-nonce=" << static_cast<double>(dnl.getNBytes()) / dnl.size()
+                << " has-hit=" << std::chrono::duration_cast<nanoseconds>(t2 - t1).count() / nLookups
+                << "ns (" << nHits << "/" << nLookups << ")"
+                << " has-miss=" << std::chrono::duration_cast<nanoseconds>(t3 - t2).count() / nLookups
+                << "ns (fp=" << nFalsePositives << "/" << nLookups << ")"
+                << std::endl;
+    }
+  }
+}
+
+} // namespace tests
+} // namespace nfd
@@ -25,6 +25,8 @@
 
 #include "common/global.hpp"
 #include "face/face.hpp"
+#include "face/generic-link-service.hpp"
+#include "face/io-thread.hpp"
 #include "face/tcp-channel.hpp"
 #include "face/udp-channel.hpp"
 
@@ -43,11 +45,15 @@ namespace tests {
 class FaceBenchmark
 {
 public:
-  FaceBenchmark(const char* configFileName)
-    : m_terminationSignalSet{getGlobalIoService()}
+  FaceBenchmark(const char* configFileName, size_t udpReceiveBatchSize, size_t udpSendBatchSize,
+                size_t nIoThreads, bool wantEgressScheduling)
+    : m_wantEgressScheduling{wantEgressScheduling}
+    , m_ioThreadPool{nIoThreads > 0 ? make_unique<face::IoThreadPool>(nIoThreads) : nullptr}
+    , m_terminationSignalSet{getGlobalIoService()}
     , m_tcpChannel{tcp::Endpoint{boost::asio::ip::tcp::v4(), 6363}, false,
                    bind([] { return ndn::nfd::FACE_SCOPE_NON_LOCAL; })}
-    , m_udpChannel{udp::Endpoint{boost::asio::ip::udp::v4(), 6363}, 10_min, false}
+    , m_udpChannel{udp::Endpoint{boost::asio::ip::udp::v4(), 6363}, 10_min, false,
+                   udpReceiveBatchSize, udpSendBatchSize, m_ioThreadPool.get()}
   {
     m_terminationSignalSet.add(SIGINT);
     m_terminationSignalSet.add(SIGTERM);
@@ -100,6 +106,7 @@ private:
   {
     std::clog << "Left face created: remote=" << faceL->getRemoteUri()
               << " local=" << faceL->getLocalUri() << std::endl;
+    configureFace(*faceL);
 
     // find a matching right uri
     FaceUri uriR;
@@ -140,11 +147,25 @@ private:
   {
     std::clog << "Right face created: remote=" << faceR->getRemoteUri()
               << " local=" << faceR->getLocalUri() << std::endl;
+    configureFace(*faceR);
 
     tieFaces(faceR, faceL);
     tieFaces(faceL, faceR);
   }
 
+  void
+  configureFace(Face& newFace) const
+  {
+    auto linkService = dynamic_cast<face::GenericLinkService*>(newFace.getLinkService());
+    if (!m_wantEgressScheduling || linkService == nullptr) {
+      return;
+    }
+
+    auto options = linkService->getOptions();
+    options.allowEgressScheduling = true;
+    linkService->setOptions(options);
+  }
+
   static void
   tieFaces(const shared_ptr<Face>& face1, const shared_ptr<Face>& face2)
   {
@@ -166,6 +187,8 @@ private:
   }
 
 private:
+  bool m_wantEgressScheduling;
+  unique_ptr<face::IoThreadPool> m_ioThreadPool;
   boost::asio::signal_set m_terminationSignalSet;
   face::TcpChannel m_tcpChannel;
   face::UdpChannel m_udpChannel;
@@ -182,13 +205,21 @@ main(int argc, char** argv)
   std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
 #endif
 
-  if (argc != 2) {
-    std::cerr << "Usage: " << argv[0] << " <config-file>" << std::endl;
+  if (argc < 2 || argc > 6) {
+    std::cerr << "Usage: " << argv[0]
+              << " <config-file> [udp-recv-batch-size [udp-send-batch-size [io-threads"
+                 " [egress-scheduling]]]]"
+              << std::endl;
     return 2;
   }
 
   try {
-    nfd::tests::FaceBenchmark bench{argv[1]};
+    size_t udpReceiveBatchSize = argc > 2 ? boost::lexical_cast<size_t>(argv[2]) : 1;
+    size_t udpSendBatchSize = argc > 3 ? boost::lexical_cast<size_t>(argv[3]) : 1;
+    size_t nIoThreads = argc > 4 ? boost::lexical_cast<size_t>(argv[4]) : 0;
+    bool wantEgressScheduling = argc > 5 ? boost::lexical_cast<bool>(argv[5]) : false;
+    nfd::tests::FaceBenchmark bench{argv[1], udpReceiveBatchSize, udpSendBatchSize, nIoThreads,
+                                    wantEgressScheduling};
 #ifdef HAVE_VALGRIND
     CALLGRIND_START_INSTRUMENTATION;
 #endif
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "common/city-hash.hpp"
+#include "table/name-tree-hashtable.hpp"
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+using name_tree::HashSequence;
+using name_tree::HashValue;
+
+class NameHashBenchmarkFixture
+{
+protected:
+  NameHashBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  /** \brief the computeHashes implementation before the single-pass routine,
+   *         which accesses each component through Name::operator[] and hashes it with CityHash
+   */
+  static HashSequence
+  computeHashesReference(const Name& name)
+  {
+    name.wireEncode();
+
+    HashSequence seq;
+    seq.reserve(name.size() + 1);
+
+    HashValue h = 0;
+    seq.push_back(h);
+    for (size_t i = 0; i < name.size(); ++i) {
+      const name::Component& comp = name[i];
+      h ^= static_cast<HashValue>(CityHash64(reinterpret_cast<const char*>(comp.wire()), comp.size()));
+      seq.push_back(h);
+    }
+    return seq;
+  }
+
+  static std::vector<Name>
+  makeNames(size_t nNames, size_t nComponents, size_t componentLength)
+  {
+    std::vector<Name> names;
+    names.reserve(nNames);
+    for (size_t i = 0; i < nNames; ++i) {
+      Name name;
+      for (size_t j = 0; j < nComponents; ++j) {
+        std::string value = to_string(i * nComponents + j);
+        value.resize(componentLength, 'x');
+        name.append(value);
+      }
+      name.wireEncode();
+      names.push_back(std::move(name));
+    }
+    return names;
+  }
+
+  template<typename F>
+  static time::microseconds
+  timedRun(const std::vector<Name>& names, size_t nRepeats, const F& f)
+  {
+    HashValue sink = 0;
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    for (size_t r = 0; r < nRepeats; ++r) {
+      for (const Name& name : names) {
+        sink ^= f(name).back();
+      }
+    }
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    // prevent the computation from being optimized away
+    if (sink == 1) {
+      std::cout << ' ';
+    }
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(ComputeHashes, NameHashBenchmarkFixture)
+{
+  // number of distinct names
+  const size_t nNames = 10000;
+  // number of times every name is hashed
+  const size_t nRepeats = 100;
+  // {number of components, length of each component value}
+  const std::pair<size_t, size_t> shapes[] = {{4, 8}, {8, 16}, {16, 32}, {32, 8}};
+
+  std::cout << "accelerated=" << std::boolalpha << name_tree::hasAcceleratedHash() << std::endl;
+
+  for (const auto& shape : shapes) {
+    auto names = makeNames(nNames, shape.first, shape.second);
+
+    auto reference = timedRun(names, nRepeats, &computeHashesReference);
+    auto current = timedRun(names, nRepeats, [] (const Name& name) {
+      return name_tree::computeHashes(name);
+    });
+
+    std::cout << "components=" << shape.first << " length=" << shape.second
+              << " reference=" << reference << " current=" << current << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace nfd
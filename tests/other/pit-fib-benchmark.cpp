@@ -24,10 +24,20 @@
  */
 
 #include "benchmark-helpers.hpp"
+#include "common/global.hpp"
+#include "common/timer-wheel.hpp"
+#include "face/null-face.hpp"
+#include "fw/forwarder.hpp"
+#include "fw/shard-selector.hpp"
+#include "table/cleanup.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
 
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
 #include <iostream>
+#include <random>
+#include <thread>
 
 #ifdef HAVE_VALGRIND
 #include <valgrind/callgrind.h>
@@ -149,5 +159,535 @@ BOOST_FIXTURE_TEST_CASE(SimpleExchanges, PitFibBenchmarkFixture)
   std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
 }
 
+// This test case models a sharded forwarding plane, where each worker thread owns a NameTree, FIB,
+// and PIT, and receives the Interest-Data exchanges whose names are assigned to it by ShardSelector.
+// The FIB is replicated to every shard. Packets are dispatched before the measurement starts.
+// For each number of shards, it reports the wall-clock time of all exchanges, which should
+// decrease close to linearly as long as there are enough cores.
+BOOST_AUTO_TEST_CASE(ShardedExchanges)
+{
+  // number of Interest-Data exchanges
+  const size_t nRoundTrip = 1000000;
+  // number of iterations between processing incoming Interest and processing incoming Data
+  const size_t replyGap = 20000;
+  // number of FIB entries, each has a two-component prefix
+  const size_t nFibEntries = 2000;
+  // number of leading name components that determine the shard
+  const size_t shardPrefixLength = 2;
+
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+  for (size_t i = 0; i < nRoundTrip; ++i) {
+    Name name(to_string(i % nFibEntries));
+    name.append("dup").append(to_string(i));
+    interests.push_back(make_shared<Interest>(name));
+    data.push_back(make_shared<Data>(Name(name).append("dup")));
+  }
+
+  size_t maxShards = std::max(std::thread::hardware_concurrency(), 1U);
+  for (size_t nShards = 1; nShards <= maxShards; nShards *= 2) {
+    fw::ShardSelector select(nShards, shardPrefixLength);
+    std::vector<std::vector<size_t>> dispatched(nShards);
+    for (size_t i = 0; i < nRoundTrip; ++i) {
+      dispatched[select(interests[i]->getName())].push_back(i);
+    }
+
+    auto runShard = [&] (const std::vector<size_t>& packets) {
+      NameTree nameTree;
+      Fib fib(nameTree);
+      Pit pit(nameTree);
+      for (size_t i = 0; i < nFibEntries; ++i) {
+        fib.insert(Name(to_string(i)).append("dup"));
+      }
+
+      size_t gap = std::min(replyGap, packets.size());
+      for (size_t i = 0; i < packets.size() + gap; ++i) {
+        if (i < packets.size()) {
+          auto pitEntry = pit.insert(*interests[packets[i]]).first;
+          fib.findLongestPrefixMatch(*pitEntry);
+        }
+        if (i >= gap) {
+          auto matches = pit.findAllDataMatches(*data[packets[i - gap]]);
+          for (const auto& pitEntry : matches) {
+            pit.erase(pitEntry.get());
+          }
+        }
+      }
+      BOOST_ASSERT(pit.size() == 0);
+    };
+
+    auto t1 = time::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (const auto& packets : dispatched) {
+      workers.emplace_back(runShard, std::cref(packets));
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    auto t2 = time::steady_clock::now();
+
+    auto minmax = std::minmax_element(dispatched.begin(), dispatched.end(),
+      [] (const auto& a, const auto& b) { return a.size() < b.size(); });
+    std::cout << "shards=" << nShards
+              << " time=" << time::duration_cast<time::milliseconds>(t2 - t1)
+              << " min-shard=" << minmax.first->size()
+              << " max-shard=" << minmax.second->size()
+              << std::endl;
+  }
+}
+
+// This test case compares the NameTree hashtable implementations with large tables.
+// For each table size and implementation, it reports the time to populate the FIB, the slowest
+// single FIB insertion (which includes any hashtable resize), and the time of Interest-Data
+// exchanges whose names fall under random FIB prefixes.
+// Note: 10M NameTree entries require several GB of memory.
+BOOST_AUTO_TEST_CASE(HashtableComparison)
+{
+  // number of NameTree entries created by FIB insertions
+  const size_t tableSizes[] = {1000000, 10000000};
+  const name_tree::HashtableType hashtableTypes[] = {
+    name_tree::HashtableType::CHAINED,
+    name_tree::HashtableType::OPEN_ADDRESSING,
+  };
+  // number of Interest-Data exchanges
+  const size_t nRoundTrip = 1000000;
+  // number of iterations between processing incoming Interest and processing incoming Data
+  const size_t replyGap = 20000;
+
+  for (size_t tableSize : tableSizes) {
+    // each FIB prefix /i/dup creates two NameTree entries
+    const size_t nFibEntries = tableSize / 2;
+
+    std::vector<shared_ptr<Interest>> interests;
+    std::vector<shared_ptr<Data>> data;
+    std::mt19937 gen(tableSize);
+    std::uniform_int_distribution<size_t> dist(0, nFibEntries - 1);
+    for (size_t i = 0; i < nRoundTrip; ++i) {
+      Name name(to_string(dist(gen)));
+      name.append("dup").append(to_string(i));
+      interests.push_back(make_shared<Interest>(name));
+      data.push_back(make_shared<Data>(Name(name).append("dup")));
+    }
+
+    for (auto hashtableType : hashtableTypes) {
+      NameTree nameTree;
+      nameTree.setHashtableType(hashtableType);
+      Fib fib(nameTree);
+      Pit pit(nameTree);
+
+      time::nanoseconds maxInsertTime = 0_ns;
+      auto t1 = time::steady_clock::now();
+      for (size_t i = 0; i < nFibEntries; ++i) {
+        Name prefix(to_string(i));
+        prefix.append("dup");
+        auto t = time::steady_clock::now();
+        fib.insert(prefix);
+        maxInsertTime = std::max(maxInsertTime, time::steady_clock::now() - t);
+      }
+      auto t2 = time::steady_clock::now();
+
+      for (size_t i = 0; i < nRoundTrip + replyGap; ++i) {
+        if (i < nRoundTrip) {
+          auto pitEntry = pit.insert(*interests[i]).first;
+          fib.findLongestPrefixMatch(*pitEntry);
+        }
+        if (i >= replyGap) {
+          auto matches = pit.findAllDataMatches(*data[i - replyGap]);
+          for (const auto& pitEntry : matches) {
+            pit.erase(pitEntry.get());
+          }
+        }
+      }
+      auto t3 = time::steady_clock::now();
+
+      std::cout << hashtableType << " entries=" << nameTree.size()
+                << " fill=" << time::duration_cast<time::milliseconds>(t2 - t1)
+                << " max-insert=" << time::duration_cast<time::microseconds>(maxInsertTime)
+                << " exchanges=" << time::duration_cast<time::milliseconds>(t3 - t2)
+                << std::endl;
+    }
+  }
+}
+
+// This test case compares FIB longest prefix match by Name with and without the LPM filter.
+// The FIB has 500k prefixes of 2 to 4 components, and the NameTree additionally holds the names
+// of pending Interests. Lookup names have 8 components, so that most prefix lengths of a lookup
+// name have no FIB entry. It reports the average time per lookup.
+BOOST_AUTO_TEST_CASE(LpmFilter)
+{
+  // number of FIB prefixes
+  const size_t nFibEntries = 500000;
+  // number of PIT entries, whose names are also lookup names
+  const size_t nPitEntries = 500000;
+  // number of lookups
+  const size_t nLookups = 5000000;
+  // number of components in a lookup name
+  const size_t lookupNameLength = 8;
+
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+
+  std::mt19937 gen(42);
+  std::vector<Name> fibPrefixes;
+  for (size_t i = 0; i < nFibEntries; ++i) {
+    Name prefix("site");
+    prefix.appendNumber(i % 1000);
+    size_t prefixLength = 2 + i % 3;
+    while (prefix.size() < prefixLength) {
+      prefix.appendNumber(i);
+    }
+    fib.insert(prefix);
+    fibPrefixes.push_back(prefix);
+  }
+
+  std::uniform_int_distribution<size_t> dist(0, nFibEntries - 1);
+  std::vector<Name> names;
+  for (size_t i = 0; i < nPitEntries; ++i) {
+    Name name = fibPrefixes[dist(gen)];
+    while (name.size() < lookupNameLength) {
+      name.appendNumber(i);
+    }
+    pit.insert(*make_shared<Interest>(name));
+    names.push_back(name);
+  }
+
+  for (bool isFiltered : {false, true}) {
+    fib.setLpmFilterEnabled(isFiltered);
+
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < nLookups; ++i) {
+      fib.findLongestPrefixMatch(names[i % names.size()]);
+    }
+    auto t2 = time::steady_clock::now();
+
+    std::cout << (isFiltered ? "filtered" : "unfiltered") << " nametree-entries=" << nameTree.size()
+              << " per-lookup=" << (t2 - t1) / nLookups
+              << std::endl;
+  }
+}
+
+// This test case compares effective strategy lookups for PIT entries, as done on every Interest,
+// Data, and Nack dispatch, with and without the effective strategy cache on NameTree entries.
+// StrategyChoice entries are at the second level, and PIT entries are far below them, so that
+// an uncached lookup walks up many NameTree levels. It reports the average time per lookup.
+BOOST_AUTO_TEST_CASE(EffectiveStrategy)
+{
+  // number of StrategyChoice entries
+  const size_t nStrategyChoiceEntries = 1000;
+  // number of PIT entries
+  const size_t nPitEntries = 200000;
+  // number of components in a PIT entry name
+  const size_t pitNameLength = 20;
+  // number of lookups for each PIT entry
+  const size_t nRounds = 5;
+
+  FaceTable faceTable;
+  Forwarder forwarder(faceTable);
+  NameTree& nameTree = forwarder.getNameTree();
+  StrategyChoice& sc = forwarder.getStrategyChoice();
+  Pit& pit = forwarder.getPit();
+
+  for (size_t i = 0; i < nStrategyChoiceEntries; ++i) {
+    Name prefix("site");
+    prefix.appendNumber(i);
+    BOOST_REQUIRE(sc.insert(prefix, i % 2 == 0 ? "/localhost/nfd/strategy/multicast"
+                                               : "/localhost/nfd/strategy/best-route"));
+  }
+
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (size_t i = 0; i < nPitEntries; ++i) {
+    Name name("site");
+    name.appendNumber(i % nStrategyChoiceEntries);
+    while (name.size() < pitNameLength) {
+      name.appendNumber(i / nStrategyChoiceEntries * pitNameLength + name.size());
+    }
+    pitEntries.push_back(pit.insert(*make_shared<Interest>(name)).first);
+  }
+
+  auto lookup = [&] (const std::string& label, const auto& find) {
+    uintptr_t sum = 0;
+    auto t1 = time::steady_clock::now();
+    for (size_t round = 0; round < nRounds; ++round) {
+      for (const auto& pitEntry : pitEntries) {
+        sum += reinterpret_cast<uintptr_t>(&find(*pitEntry));
+      }
+    }
+    auto t2 = time::steady_clock::now();
+    std::cout << label << " nametree-entries=" << nameTree.size()
+              << " per-lookup=" << (t2 - t1) / (nRounds * nPitEntries)
+              << std::endl;
+    return sum;
+  };
+
+  auto uncachedSum = lookup("uncached", [&] (const pit::Entry& pitEntry) -> fw::Strategy& {
+    const name_tree::Entry* nte = nameTree.findLongestPrefixMatch(pitEntry,
+      [] (const name_tree::Entry& e) { return e.getStrategyChoiceEntry() != nullptr; });
+    return nte->getStrategyChoiceEntry()->getStrategy();
+  });
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  auto cachedSum = lookup("cached", [&] (const pit::Entry& pitEntry) -> fw::Strategy& {
+    return sc.findEffectiveStrategy(pitEntry);
+  });
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  BOOST_CHECK_EQUAL(cachedSum, uncachedSum);
+}
+
+// This test case compares the forwarding pipelines processing one packet per call with batched
+// processing through Forwarder::startProcessBatch, which hashes each name once and prefetches the
+// NameTree buckets and entries of upcoming packets. Interests fall under random prefixes of a large
+// FIB, so that most NameTree lookups miss the CPU caches. Interests and Data are passed to the
+// Forwarder in arrival order, in batches of each size, where batch size 0 means one
+// startProcessInterest or startProcessData call per packet. It reports the average time per
+// Interest-Data exchange.
+BOOST_AUTO_TEST_CASE(BatchedPipeline)
+{
+  // number of FIB prefixes
+  const size_t nFibEntries = 1000000;
+  // number of Interest-Data exchanges
+  const size_t nRoundTrip = 500000;
+  // number of Interests between processing an Interest and processing its Data
+  const size_t replyGap = 20000;
+  // number of packets in each batch
+  const size_t batchSizes[] = {0, 1, 8, 32};
+
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+  std::mt19937 gen(nFibEntries);
+  std::uniform_int_distribution<size_t> dist(0, nFibEntries - 1);
+  for (size_t i = 0; i < nRoundTrip; ++i) {
+    Name name(to_string(dist(gen)));
+    name.append("dup").appendNumber(i);
+    interests.push_back(make_shared<Interest>(name));
+    interests.back()->setNonce(static_cast<uint32_t>(i));
+    data.push_back(make_shared<Data>(name));
+    ndn::SignatureSha256WithRsa fakeSignature;
+    fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+    data.back()->setSignature(fakeSignature);
+    data.back()->wireEncode();
+  }
+
+  for (size_t batchSize : batchSizes) {
+    FaceTable faceTable;
+    Forwarder forwarder(faceTable);
+    auto downstream = face::makeNullFace();
+    auto upstream = face::makeNullFace();
+    faceTable.add(downstream);
+    faceTable.add(upstream);
+
+    Fib& fib = forwarder.getFib();
+    for (size_t i = 0; i < nFibEntries; ++i) {
+      Name prefix(to_string(i));
+      prefix.append("dup");
+      fib.addOrUpdateNextHop(*fib.insert(prefix).first, *upstream, 0);
+    }
+
+    std::vector<Forwarder::IncomingPacket> batch;
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < nRoundTrip + replyGap; ++i) {
+      if (i < nRoundTrip) {
+        if (batchSize == 0) {
+          forwarder.startProcessInterest(FaceEndpoint(*downstream, 0), *interests[i]);
+        }
+        else {
+          batch.push_back({FaceEndpoint(*downstream, 0), interests[i], nullptr});
+        }
+      }
+      if (i >= replyGap) {
+        if (batchSize == 0) {
+          forwarder.startProcessData(FaceEndpoint(*upstream, 0), *data[i - replyGap]);
+        }
+        else {
+          batch.push_back({FaceEndpoint(*upstream, 0), nullptr, data[i - replyGap]});
+        }
+      }
+      if (batchSize > 0 && batch.size() >= batchSize) {
+        forwarder.startProcessBatch(batch);
+        batch.clear();
+      }
+    }
+    forwarder.startProcessBatch(batch);
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, nRoundTrip);
+    std::cout << "batch-size=" << batchSize << " nametree-entries=" << forwarder.getNameTree().size()
+              << " per-exchange=" << (t2 - t1) / nRoundTrip
+              << std::endl;
+  }
+}
+
+// This test case compares the cost of PIT expiry timers on the Scheduler and on the TimerWheel.
+// Each Interest arms a timer for its lifetime, re-arms it when a retransmission arrives, and
+// cancels it when the Data arrives, as the forwarding pipelines do. No timer fires.
+// It reports the average time per Interest for each implementation.
+BOOST_AUTO_TEST_CASE(ExpiryTimers)
+{
+  // number of Interests
+  const size_t nInterests = 1000000;
+  // number of Interests between the arrival of an Interest and its retransmission
+  const size_t retxGap = 1000;
+  // number of Interests between the arrival of an Interest and its Data
+  const size_t replyGap = 20000;
+
+  std::vector<time::milliseconds> lifetimes;
+  std::mt19937 gen(nInterests);
+  std::uniform_int_distribution<int> dist(1000, 4000);
+  for (size_t i = 0; i < nInterests; ++i) {
+    lifetimes.push_back(time::milliseconds(dist(gen)));
+  }
+
+  {
+    std::vector<scheduler::EventId> timers(nInterests);
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < nInterests + replyGap; ++i) {
+      if (i < nInterests) {
+        timers[i] = getScheduler().schedule(lifetimes[i], [] {});
+      }
+      if (i >= retxGap && i - retxGap < nInterests) {
+        size_t j = i - retxGap;
+        timers[j].cancel();
+        timers[j] = getScheduler().schedule(lifetimes[j], [] {});
+      }
+      if (i >= replyGap) {
+        timers[i - replyGap].cancel();
+      }
+    }
+    auto t2 = time::steady_clock::now();
+    std::cout << "scheduler " << (t2 - t1) / nInterests << " per Interest" << std::endl;
+  }
+
+  {
+    std::vector<WheelTimer> timers(nInterests);
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < nInterests + replyGap; ++i) {
+      if (i < nInterests) {
+        getTimerWheel().schedule(timers[i], lifetimes[i], [] {});
+      }
+      if (i >= retxGap && i - retxGap < nInterests) {
+        size_t j = i - retxGap;
+        getTimerWheel().schedule(timers[j], lifetimes[j], [] {});
+      }
+      if (i >= replyGap) {
+        timers[i - replyGap].cancel();
+      }
+    }
+    auto t2 = time::steady_clock::now();
+    std::cout << "timer-wheel " << (t2 - t1) / nInterests << " per Interest" << std::endl;
+  }
+}
+
+/** \brief the cleanupOnFaceRemoval implementation before per-face indexes,
+ *         which enumerates the entire NameTree
+ */
+static void
+cleanupOnFaceRemovalReference(NameTree& nt, Fib& fib, Pit& pit, const Face& face)
+{
+  std::multimap<size_t, const name_tree::Entry*> maybeEmptyNtes;
+
+  for (const name_tree::Entry& nte : nt) {
+    fib::Entry* fibEntry = nte.getFibEntry();
+    if (fibEntry != nullptr) {
+      fib.removeNextHop(*fibEntry, face);
+    }
+
+    for (const auto& pitEntry : nte.getPitEntries()) {
+      pit.deleteInOutRecords(pitEntry.get(), face);
+    }
+
+    if (!nte.hasTableEntries()) {
+      maybeEmptyNtes.emplace(nte.getName().size(), &nte);
+    }
+  }
+
+  for (auto i = maybeEmptyNtes.rbegin(); i != maybeEmptyNtes.rend(); ++i) {
+    nt.eraseIfEmpty(const_cast<name_tree::Entry*>(i->second), false);
+  }
+}
+
+// This test case models the removal of on-demand faces while the PIT is large.
+// Every PIT entry has an in-record and an out-record, and every FIB entry has one nexthop,
+// spread evenly over nFaces faces. Faces are then removed one by one, some with the
+// reference cleanup that enumerates the NameTree, and the rest with the indexed cleanup.
+// It reports the average and maximum time to remove one face for each implementation.
+BOOST_AUTO_TEST_CASE(FaceChurn)
+{
+  // number of faces
+  const size_t nFaces = 1000;
+  // number of PIT entries
+  const size_t nPitEntries = 1000000;
+  // number of FIB entries
+  const size_t nFibEntries = 100000;
+  // number of faces removed with the reference cleanup, which is slow
+  const size_t nReferenceRemovals = 20;
+
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    faces.push_back(face::makeNullFace());
+  }
+
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+
+  for (size_t i = 0; i < nFibEntries; ++i) {
+    fib::Entry* fibEntry = fib.insert(Name("/fib").appendNumber(i)).first;
+    fib.addOrUpdateNextHop(*fibEntry, *faces[i % nFaces], 0);
+  }
+
+  for (size_t i = 0; i < nPitEntries; ++i) {
+    auto interest = make_shared<Interest>(Name("/pit").appendNumber(i));
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*faces[i % nFaces], *interest);
+    pitEntry->insertOrUpdateOutRecord(*faces[(i * 7 + 1) % nFaces], *interest);
+  }
+
+  auto removeFaces = [&] (size_t first, size_t last, const auto& cleanup) {
+    time::nanoseconds total = 0_ns;
+    time::nanoseconds maxTime = 0_ns;
+    for (size_t i = first; i < last; ++i) {
+      auto t1 = time::steady_clock::now();
+      cleanup(nameTree, fib, pit, *faces[i]);
+      auto t = time::steady_clock::now() - t1;
+      total += t;
+      maxTime = std::max(maxTime, t);
+    }
+    std::cout << " avg=" << time::duration_cast<time::microseconds>(total / (last - first))
+              << " max=" << time::duration_cast<time::microseconds>(maxTime) << std::endl;
+  };
+
+  std::cout << "reference";
+  removeFaces(0, nReferenceRemovals, &cleanupOnFaceRemovalReference);
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  std::cout << "indexed";
+  removeFaces(nReferenceRemovals, nFaces, &cleanupOnFaceRemoval);
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+}
+
 } // namespace tests
 } // namespace nfd
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2020,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "common/global.hpp"
+#include "face/face.hpp"
+#include "face/unix-stream-transport.hpp"
+
+#include <chrono>
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+/** \brief a LinkService that only counts received packets
+ */
+class CountingLinkService final : public face::LinkService
+{
+public:
+  size_t nReceivedPackets = 0;
+
+private:
+  void
+  doSendInterest(const Interest&) final
+  {
+  }
+
+  void
+  doSendData(const Data&) final
+  {
+  }
+
+  void
+  doSendNack(const lp::Nack&) final
+  {
+  }
+
+  void
+  doReceivePacket(const Block&, const face::EndpointId&) final
+  {
+    ++nReceivedPackets;
+  }
+};
+
+// This test case streams packets of several sizes over a Unix stream socket, as a local
+// application would, and reports the receive rate of UnixStreamTransport together with
+// the number of bytes it copied per packet while framing the stream.
+BOOST_AUTO_TEST_CASE(ReceiveFraming)
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+  const size_t packetSizes[] = {300, 1500, 4500, 8192, ndn::MAX_NDN_PACKET_SIZE};
+  // number of bytes streamed for each packet size
+  const size_t nStreamBytes = 256 * 1024 * 1024;
+
+  for (size_t packetSize : packetSizes) {
+    // a Data-typed element whose total size is packetSize
+    std::vector<uint8_t> value(packetSize);
+    Block packet = ndn::encoding::makeBinaryBlock(tlv::Data, value.data(), packetSize - 4);
+    size_t nPackets = nStreamBytes / packet.size();
+    std::vector<uint8_t> stream;
+    stream.reserve(nPackets * packet.size());
+    for (size_t i = 0; i < nPackets; ++i) {
+      stream.insert(stream.end(), packet.begin(), packet.end());
+    }
+
+    boost::asio::local::stream_protocol::socket localSocket(getGlobalIoService());
+    boost::asio::local::stream_protocol::socket remoteSocket(getGlobalIoService());
+    boost::asio::local::connect_pair(localSocket, remoteSocket);
+
+    auto linkService = make_unique<CountingLinkService>();
+    auto* counter = linkService.get();
+    Face face(std::move(linkService), make_unique<face::UnixStreamTransport>(std::move(localSocket)));
+    const auto& counters = static_cast<const face::UnixStreamTransport*>(face.getTransport())->getCounters();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = std::chrono::steady_clock::now();
+    boost::asio::async_write(remoteSocket, boost::asio::buffer(stream), [] (const auto&, size_t) {});
+    while (counter->nReceivedPackets < nPackets) {
+      getGlobalIoService().run_one();
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+    std::cout << "packet-size=" << packet.size()
+              << " packets=" << nPackets
+              << " rate=" << nPackets * 1000000 / std::max<int64_t>(duration.count(), 1) << "pps"
+              << " bytes-copied-per-packet="
+              << static_cast<double>(counters.nInBytesCopied) / counters.nInPackets
+              << std::endl;
+
+    face.close();
+    getGlobalIoService().poll();
+  }
+}
+
+} // namespace tests
+} // namespace nfd